@@ -166,15 +166,21 @@ namespace Gambit {
                                                        0.25*0.25,0.25*0.25,0.25*0.25,
                                                        0.,       0.,       0.}});
 
+          // Look up the resolution coefficients for all electrons within |eta| < 5 in one go
+          std::vector<HEPUtils::Particle*> inrange;
+          inrange.reserve(electrons.size());
+          for (HEPUtils::Particle* e : electrons) if (e->abseta() <= 5) inrange.push_back(e);
+          std::vector<double> c1s, c2s, c3s;
+          binned_values_etapt(coeffE2, inrange, c1s);
+          binned_values_etapt(coeffE, inrange, c2s);
+          binned_values_etapt(coeffC, inrange, c3s);
+
           // Now loop over the electrons and smear the 4-vectors
-          for (HEPUtils::Particle* e : electrons) {
-            if (e->abseta() > 5) continue;
+          for (size_t i = 0; i < inrange.size(); ++i) {
+            HEPUtils::Particle* e = inrange[i];
 
-            // Look up / calculate resolution
-            const double c1 = coeffE2.get_at(e->abseta(), e->pT());
-            const double c2 = coeffE.get_at(e->abseta(), e->pT());
-            const double c3 = coeffC.get_at(e->abseta(), e->pT());
-            const double resolution = sqrt(c1*HEPUtils::sqr(e->E()) + c2*e->E() + c3);
+            // Calculate resolution
+            const double resolution = sqrt(c1s[i]*HEPUtils::sqr(e->E()) + c2s[i]*e->E() + c3s[i]);
 
             // Smear by a Gaussian centered on the current energy, with width given by the resolution
             std::normal_distribution<> d(e->E(), resolution);
@@ -198,12 +204,17 @@ namespace Gambit {
                                                      {{0.,0.03,0.02,0.03,0.05,
                                                        0.,0.04,0.03,0.04,0.05}});
 
-          // Now loop over the muons and smear the 4-vectors
-          for (HEPUtils::Particle* mu : muons) {
-            if (mu->abseta() > 2.5) continue;
+          // Look up the resolutions for all muons within |eta| < 2.5 in one go
+          std::vector<HEPUtils::Particle*> inrange;
+          inrange.reserve(muons.size());
+          for (HEPUtils::Particle* mu : muons) if (mu->abseta() <= 2.5) inrange.push_back(mu);
+          std::vector<double> resolutions;
+          binned_values_etapt(_muEff, inrange, resolutions);
 
-            // Look up resolution
-            const double resolution = _muEff.get_at(mu->abseta(), mu->pT());
+          // Now loop over the muons and smear the 4-vectors
+          for (size_t i = 0; i < inrange.size(); ++i) {
+            HEPUtils::Particle* mu = inrange[i];
+            const double resolution = resolutions[i];
 
             // Smear by a Gaussian centered on the current energy, with width given by the resolution
             std::normal_distribution<> d(mu->pT(), resolution*mu->pT());
@@ -231,9 +242,14 @@ namespace Gambit {
           const std::vector<double> JetsJER = {0.145,0.115,0.095,0.075,0.07,0.05,0.04};
           static HEPUtils::BinnedFn2D<double> _resJets2D(binedges_eta,binedges_pt,JetsJER);
 
+          // Look up all the resolutions in one go
+          std::vector<double> resolutions;
+          binned_values_etapt(_resJets2D, jets, resolutions);
+
           // Now loop over the jets and smear the 4-vectors
-          for (HEPUtils::Jet* jet : jets) {
-            const double resolution = _resJets2D.get_at(jet->abseta(), jet->pT());
+          for (size_t i = 0; i < jets.size(); ++i) {
+            HEPUtils::Jet* jet = jets[i];
+            const double resolution = resolutions[i];
             std::normal_distribution<> d(1., resolution);
             // Smear by a Gaussian centered on 1 with width given by the (fractional) resolution
             double smear_factor = d(Random::rng());
@@ -188,9 +188,14 @@ namespace Gambit {
         const std::vector<double> JetsJER = {0.3,0.2,0.16,0.145,0.12,0.1,0.09,0.08,0.06,0.05};
         static HEPUtils::BinnedFn2D<double> _resJets2D(binedges_eta,binedges_pt,JetsJER);
 
+        // Look up all the resolutions in one go
+        std::vector<double> resolutions;
+        binned_values_etapt(_resJets2D, jets, resolutions);
+
         // Now loop over the jets and smear the 4-vectors
-        for (HEPUtils::Jet* jet : jets) {
-          const double resolution = _resJets2D.get_at(jet->abseta(), jet->pT());
+        for (size_t i = 0; i < jets.size(); ++i) {
+          HEPUtils::Jet* jet = jets[i];
+          const double resolution = resolutions[i];
           std::normal_distribution<> d(1., resolution);
           // Smear by a Gaussian centered on 1 with width given by the (fractional) resolution
           double smear_factor = d(Random::rng());
@@ -0,0 +1,318 @@
+#pragma once
+//   GAMBIT: Global and Modular BSM Inference Tool
+//   *********************************************
+///  \file
+///
+///  A columnar (structure-of-arrays) view of a
+///  reconstructed HEPUtils::Event, plus kernels
+///  for the object selections, Delta R overlap
+///  removals and transverse-mass variables that
+///  most ColliderBit analyses share.
+///
+///  The kernels run over contiguous double arrays
+///  without branching on the object pointers, so
+///  the compiler can vectorise them. Results agree
+///  exactly with the equivalent HEPUtils calls.
+///
+///  The view also memoises derived objects (named
+///  selections and quantities such as mT2) for the
+///  duration of one event, so analyses run on the
+///  same event can share them.
+///
+///  *********************************************
+
+#include "gambit/ColliderBit/Utils.hpp"
+#include "HEPUtils/Event.h"
+
+#include <vector>
+#include <string>
+#include <functional>
+#include <unordered_map>
+#include <cmath>
+#include <cstdint>
+#include <algorithm>
+
+namespace Gambit {
+  namespace ColliderBit {
+
+
+    /// A list of indices into an ObjectColumns
+    typedef std::vector<size_t> Selection;
+
+
+    /// Kinematic columns for one type of reconstructed object (electrons, muons, jets, ...)
+    template <typename OBJ>
+    class ObjectColumns {
+    public:
+
+      /// @name Per-object columns; entry i always describes objects[i]
+      //@{
+      std::vector<const OBJ*> objects;
+      std::vector<double> pT, eta, abseta, phi, rap, m, px, py;
+      //@}
+
+      /// Number of objects
+      size_t size() const { return objects.size(); }
+      /// Is the collection empty?
+      bool empty() const { return objects.empty(); }
+
+      /// Remove all objects, keeping the allocated capacity
+      void clear() {
+        objects.clear();
+        pT.clear(); eta.clear(); abseta.clear(); phi.clear(); rap.clear(); m.clear(); px.clear(); py.clear();
+      }
+
+      /// Append one object
+      void push_back(const OBJ* obj) {
+        const P4& p = obj->mom();
+        objects.push_back(obj);
+        const double pEta = p.eta();
+        pT.push_back(p.pT());
+        eta.push_back(pEta);
+        abseta.push_back(std::fabs(pEta));
+        phi.push_back(p.phi());
+        rap.push_back(p.rap());
+        m.push_back(p.m());
+        px.push_back(p.px());
+        py.push_back(p.py());
+      }
+
+      /// Replace the contents with the given objects
+      template <typename PTR>
+      void fill(const std::vector<PTR>& objs) {
+        clear();
+        for (const OBJ* obj : objs) push_back(obj);
+      }
+
+      /// Indices of all objects
+      Selection all() const {
+        Selection rtn(size());
+        for (size_t i = 0; i < rtn.size(); ++i) rtn[i] = i;
+        return rtn;
+      }
+
+      /// The objects picked out by a selection, for handing to code that still uses object pointers
+      std::vector<const OBJ*> get(const Selection& sel) const {
+        std::vector<const OBJ*> rtn;
+        rtn.reserve(sel.size());
+        for (size_t i : sel) rtn.push_back(objects[i]);
+        return rtn;
+      }
+
+    };
+
+
+    /// Columns for leptons and photons
+    class ParticleColumns : public ObjectColumns<Particle> {
+    public:
+      /// PDG code of each particle
+      std::vector<int> pid;
+      void clear() { ObjectColumns<Particle>::clear(); pid.clear(); }
+      void push_back(const Particle* p) { ObjectColumns<Particle>::push_back(p); pid.push_back(p->pid()); }
+      template <typename PTR>
+      void fill(const std::vector<PTR>& objs) { clear(); for (const Particle* p : objs) push_back(p); }
+    };
+
+
+    /// Columns for jets
+    class JetColumns : public ObjectColumns<Jet> {
+    public:
+      /// b-tag flag of each jet
+      std::vector<char> btag;
+      void clear() { ObjectColumns<Jet>::clear(); btag.clear(); }
+      void push_back(const Jet* j) { ObjectColumns<Jet>::push_back(j); btag.push_back(j->btag()); }
+      template <typename PTR>
+      void fill(const std::vector<PTR>& objs) { clear(); for (const Jet* j : objs) push_back(j); }
+    };
+
+
+    /// @brief Columnar view of all reconstructed objects in an event.
+    ///
+    /// The view is bound to an event with bind(), which is cheap; the columns
+    /// themselves are only filled the first time they are asked for. One
+    /// instance can therefore be bound once per smeared event and shared by
+    /// every analysis run on it, whether or not those analyses use it.
+    ///
+    /// Selections and scalar quantities derived from the event can be stored
+    /// under a key that fully describes their definition, e.g.
+    /// "jets pT>20 |eta|<2.8, e-overlap dR_rap>0.2"; the first analysis to ask
+    /// for a key computes it and later ones reuse the result. The memo is
+    /// cleared whenever the view is rebound.
+    class EventColumns {
+    public:
+
+      EventColumns() : _event(nullptr), _filled(false) { }
+      explicit EventColumns(const Event& e) : _event(&e), _filled(false) { }
+
+      /// Point the view at a new event; the columns are refilled on next access
+      void bind(const Event& e) { _event = &e; _filled = false; _forget(); }
+      /// Detach from the current event
+      void unbind() { _event = nullptr; _filled = false; _forget(); }
+      /// The event this view describes (null if unbound)
+      const Event* event() const { return _event; }
+
+      /// @name Object columns, in the same order as the corresponding Event accessors
+      //@{
+      const ParticleColumns& electrons() const { _fill(); return _electrons; }
+      const ParticleColumns& muons() const { _fill(); return _muons; }
+      const ParticleColumns& taus() const { _fill(); return _taus; }
+      const ParticleColumns& photons() const { _fill(); return _photons; }
+      const JetColumns& jets() const { _fill(); return _jets; }
+      //@}
+
+      /// @name Missing transverse momentum
+      //@{
+      double met() const { _fill(); return _met; }
+      double metphi() const { _fill(); return _metphi; }
+      //@}
+
+      /// @name Per-event memoisation of derived objects
+      //@{
+      /// Get the selection stored under key, computing it with make() on the first request for this event
+      const Selection& selection(const std::string& key, const std::function<Selection()>& make) const;
+      /// Get the quantity stored under key, computing it with make() on the first request for this event
+      double quantity(const std::string& key, const std::function<double()>& make) const;
+      //@}
+
+    private:
+
+      void _fill() const { if (!_filled) _do_fill(); }
+      void _do_fill() const;
+      void _forget() { _selections.clear(); _quantities.clear(); }
+
+      const Event* _event;
+      mutable bool _filled;
+      mutable ParticleColumns _electrons, _muons, _taus, _photons;
+      mutable JetColumns _jets;
+      mutable double _met, _metphi;
+      mutable std::unordered_map<std::string, Selection> _selections;
+      mutable std::unordered_map<std::string, double> _quantities;
+
+    };
+
+
+    /// @name Selection kernels
+    //@{
+
+    /// Indices (within sel) of objects with pT > ptmin and |eta| < absetamax
+    template <typename OBJ>
+    Selection select(const ObjectColumns<OBJ>& c, const Selection& sel, double ptmin, double absetamax) {
+      Selection rtn;
+      rtn.reserve(sel.size());
+      for (size_t i : sel)
+        if (c.pT[i] > ptmin && c.abseta[i] < absetamax) rtn.push_back(i);
+      return rtn;
+    }
+
+    /// Indices of all objects with pT > ptmin and |eta| < absetamax
+    template <typename OBJ>
+    Selection select(const ObjectColumns<OBJ>& c, double ptmin, double absetamax) {
+      const size_t n = c.size();
+      std::vector<char> pass(n);
+      for (size_t i = 0; i < n; ++i) pass[i] = (c.pT[i] > ptmin) & (c.abseta[i] < absetamax);
+      Selection rtn;
+      rtn.reserve(n);
+      for (size_t i = 0; i < n; ++i) if (pass[i]) rtn.push_back(i);
+      return rtn;
+    }
+
+    /// The b-tagged (or, with btagged = false, untagged) subset of a jet selection
+    Selection select_btag(const JetColumns& jets, const Selection& sel, bool btagged=true);
+
+    //@}
+
+
+    /// @name Delta R and overlap removal
+    //@{
+
+    /// Delta phi in [0, pi], identical to HEPUtils::deltaphi for azimuths in (-pi, pi]
+    inline double deltaphi_col(double a, double b) {
+      const double d = std::fabs(a - b);
+      return d > M_PI ? 2*M_PI - d : d;
+    }
+
+    /// @brief Minimum Delta R between each object in sel1 and the objects in sel2.
+    ///
+    /// Entries are +infinity if sel2 is empty. With use_rap = true the rapidity
+    /// is used (as in HEPUtils::deltaR_rap), otherwise the pseudorapidity
+    /// (as in HEPUtils::deltaR_eta).
+    template <typename OBJ1, typename OBJ2>
+    std::vector<double> min_deltaR(const ObjectColumns<OBJ1>& c1, const Selection& sel1,
+                                   const ObjectColumns<OBJ2>& c2, const Selection& sel2, bool use_rap=true) {
+      const std::vector<double>& y1 = use_rap ? c1.rap : c1.eta;
+      const std::vector<double>& y2 = use_rap ? c2.rap : c2.eta;
+      // Gather the second list once so the inner loop is contiguous
+      const size_t n2 = sel2.size();
+      std::vector<double> ys(n2), phis(n2);
+      for (size_t k = 0; k < n2; ++k) { ys[k] = y2[sel2[k]]; phis[k] = c2.phi[sel2[k]]; }
+      std::vector<double> rtn(sel1.size(), HUGE_VAL);
+      for (size_t k1 = 0; k1 < sel1.size(); ++k1) {
+        const double y = y1[sel1[k1]], phi = c1.phi[sel1[k1]];
+        double dr2min = HUGE_VAL;
+        for (size_t k = 0; k < n2; ++k) {
+          const double dy = std::fabs(y - ys[k]);
+          const double dphi = deltaphi_col(phi, phis[k]);
+          const double dr2 = dy*dy + dphi*dphi;
+          dr2min = dr2 < dr2min ? dr2 : dr2min;
+        }
+        rtn[k1] = std::sqrt(dr2min);
+      }
+      return rtn;
+    }
+
+    /// @brief Keep the objects in sel1 that are further than dRmin from every object in sel2.
+    ///
+    /// Equivalent to keeping o1 if all_of(list2, deltaR(o1, o2) > dRmin), the
+    /// overlap-removal idiom used throughout the analyses.
+    template <typename OBJ1, typename OBJ2>
+    Selection isolated(const ObjectColumns<OBJ1>& c1, const Selection& sel1,
+                       const ObjectColumns<OBJ2>& c2, const Selection& sel2, double dRmin, bool use_rap=true) {
+      if (sel2.empty()) return sel1;
+      const std::vector<double> dr = min_deltaR(c1, sel1, c2, sel2, use_rap);
+      Selection rtn;
+      rtn.reserve(sel1.size());
+      for (size_t k = 0; k < sel1.size(); ++k)
+        if (dr[k] > dRmin) rtn.push_back(sel1[k]);
+      return rtn;
+    }
+
+    //@}
+
+
+    /// @name Transverse variables
+    //@{
+
+    /// Scalar sum of pT over a selection, optionally over only its first nmax entries
+    template <typename OBJ>
+    double sum_pT(const ObjectColumns<OBJ>& c, const Selection& sel, size_t nmax=SIZE_MAX) {
+      const size_t n = std::min(sel.size(), nmax);
+      double rtn = 0;
+      for (size_t k = 0; k < n; ++k) rtn += c.pT[sel[k]];
+      return rtn;
+    }
+
+    /// Effective mass: MET plus the scalar pT sum of (the first nmax entries of) a selection
+    template <typename OBJ>
+    double meff(const EventColumns& ev, const ObjectColumns<OBJ>& c, const Selection& sel, size_t nmax=SIZE_MAX) {
+      return ev.met() + sum_pT(c, sel, nmax);
+    }
+
+    /// Transverse mass of one object and the missing momentum, for massless objects
+    inline double mT(double pt, double phi, double met, double metphi) {
+      return std::sqrt(2*pt*met*(1 - std::cos(phi - metphi)));
+    }
+
+    /// Transverse mass with the missing momentum for every object in a selection
+    template <typename OBJ>
+    std::vector<double> mT(const EventColumns& ev, const ObjectColumns<OBJ>& c, const Selection& sel) {
+      const double met = ev.met(), metphi = ev.metphi();
+      std::vector<double> rtn(sel.size());
+      for (size_t k = 0; k < sel.size(); ++k) rtn[k] = mT(c.pT[sel[k]], c.phi[sel[k]], met, metphi);
+      return rtn;
+    }
+
+    //@}
+
+
+  }
+}
@@ -0,0 +1,130 @@
+//   GAMBIT: Global and Modular BSM Inference Tool
+//   *********************************************
+///  \file
+///
+///  ColliderBit helper for generating events on a
+///  background thread, so that the next event can
+///  be produced while the current one is smeared
+///  and analysed.
+///
+///  *********************************************
+
+#ifndef __EventPrefetcher_hpp__
+#define __EventPrefetcher_hpp__
+
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <exception>
+#include <functional>
+
+namespace Gambit
+{
+  namespace ColliderBit
+  {
+
+    /// @brief Runs an event generator one event ahead of its consumer, on a dedicated thread.
+    ///
+    /// The generator function is only ever called from the worker thread, so the
+    /// object it drives (e.g. a Pythia instance) must not be used elsewhere between
+    /// start() and stop(). Events are produced into a single buffer that is reused
+    /// for the lifetime of the prefetcher. Exceptions thrown by the generator are
+    /// rethrown by next(), after the event it was working on has been handed over.
+    template <typename EventT>
+    class EventPrefetcher
+    {
+      public:
+
+        typedef std::function<void(EventT&)> generator_type;
+
+        EventPrefetcher() : _running(false), _requested(false), _ready(false), _stopping(false) {}
+        ~EventPrefetcher() { stop(); }
+
+        EventPrefetcher(const EventPrefetcher&) = delete;
+        EventPrefetcher& operator=(const EventPrefetcher&) = delete;
+
+        /// Is a worker thread currently attached?
+        bool running() const { return _running; }
+
+        /// Start a worker thread that generates events with gen, and ask it for the first one
+        void start(generator_type gen)
+        {
+          stop();
+          _gen = gen;
+          _requested = true;
+          _ready = false;
+          _stopping = false;
+          _error = nullptr;
+          _running = true;
+          _worker = std::thread(&EventPrefetcher::work, this);
+        }
+
+        /// @brief Copy the prefetched event into result and immediately start generating the next one.
+        /// Blocks until the prefetched event is available.
+        void next(EventT& result)
+        {
+          std::exception_ptr error;
+          {
+            std::unique_lock<std::mutex> lock(_mutex);
+            _cv.wait(lock, [this]{ return _ready; });
+            result = _buffer;
+            error = _error;
+            _error = nullptr;
+            _ready = false;
+            _requested = true;
+          }
+          _cv.notify_all();
+          if (error) std::rethrow_exception(error);
+        }
+
+        /// Stop the worker thread, discarding any event it is generating
+        void stop()
+        {
+          if (!_running) return;
+          {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _stopping = true;
+          }
+          _cv.notify_all();
+          _worker.join();
+          _running = false;
+        }
+
+      private:
+
+        void work()
+        {
+          while (true)
+          {
+            {
+              std::unique_lock<std::mutex> lock(_mutex);
+              _cv.wait(lock, [this]{ return _requested or _stopping; });
+              if (_stopping) return;
+              _requested = false;
+            }
+            // Generate outside the lock; the consumer does not touch the buffer until _ready is set
+            std::exception_ptr error;
+            try { _gen(_buffer); }
+            catch (...) { error = std::current_exception(); }
+            {
+              std::lock_guard<std::mutex> lock(_mutex);
+              _error = error;
+              _ready = true;
+            }
+            _cv.notify_all();
+          }
+        }
+
+        generator_type _gen;
+        EventT _buffer;
+        std::exception_ptr _error;
+        std::thread _worker;
+        std::mutex _mutex;
+        std::condition_variable _cv;
+        bool _running, _requested, _ready, _stopping;
+    };
+
+  }
+}
+
+#endif
@@ -20,6 +20,8 @@
 #ifndef __MC_convergence_hpp__
 #define __MC_convergence_hpp__
 
+#include <atomic>
+
 #include "gambit/Utils/util_types.hpp"
 #include "gambit/ColliderBit/analyses/HEPUtilsAnalysisContainer.hpp"
 
@@ -40,6 +42,48 @@ namespace Gambit
       bool all_SR_must_converge;
     };
 
+    /// @brief Lock-free hand-over of one thread's signal counts to the convergence check.
+    ///
+    /// The publishing thread and the reader each own one of three buffers, and the
+    /// third holds the most recently published counts.  Publishing and reading both
+    /// just swap buffer indices, so neither side ever waits for the other.  There must
+    /// be at most one publishing thread and one reading thread at a time.
+    class published_signals
+    {
+      private:
+
+        std::vector<int> buffers[3];
+
+        /// Buffer being filled by the publisher, and buffer last taken by the reader
+        int back, front;
+
+        /// Index of the spare buffer, plus the fresh flag if it holds unread counts
+        std::atomic<int> middle;
+
+        static const int fresh = 4;
+
+      public:
+
+        published_signals() : back(0), front(1), middle(2) {}
+
+        /// Discard all counts.  Not thread safe.
+        void clear();
+
+        /// The buffer to fill before calling publish() (publishing thread only)
+        std::vector<int>& next() { return buffers[back]; }
+
+        /// Make the contents of next() the latest counts (publishing thread only)
+        void publish() { back = middle.exchange(back | fresh, std::memory_order_acq_rel) & ~fresh; }
+
+        /// The latest published counts (reading thread only)
+        const std::vector<int>& latest()
+        {
+          if (middle.load(std::memory_order_acquire) & fresh)
+            front = middle.exchange(front, std::memory_order_acq_rel) & ~fresh;
+          return buffers[front];
+        }
+    };
+
     /// Helper class for testing for convergence of analyses
     class MC_convergence_checker
     {
@@ -51,8 +95,8 @@ namespace Gambit
         /// The index in the convergence settings to use
         int _collider;
 
-        /// Pointer to an array holding the signal counts on each thread
-        std::vector<int>* n_signals;
+        /// Pointer to an array holding the latest published signal counts of each thread
+        published_signals* n_signals;
 
         /// Total number of threads that the checker is configured to deal with
         int n_threads;
@@ -63,6 +107,9 @@ namespace Gambit
         /// A map containing pointers to all instances of this class
         static std::map<const MC_convergence_checker* const, bool> convergence_map;
 
+        /// Implementation of achieved(), to be called with the lock held
+        bool achieved_unlocked(const HEPUtilsAnalysisContainer& ac);
+
       public:
 
         /// Constructor
@@ -83,10 +130,12 @@ namespace Gambit
         /// Clear all convergence data (for all threads)
         void clear();
 
-        /// Update the convergence data.  This is the only routine meant to be called in parallel.
+        /// Update the convergence data for the calling thread.  May be called in parallel, and concurrently with achieved().
+        /// Never blocks.
         void update(const HEPUtilsAnalysisContainer&);
 
-        /// Check if convergence has been achieved across threads, and across all instances of this class
+        /// Check if convergence has been achieved across threads, and across all instances of this class.
+        /// May be called from inside an OpenMP block, by one thread at a time, while other threads call update().
         bool achieved(const HEPUtilsAnalysisContainer& ac);
     };
 
@@ -102,6 +102,69 @@ namespace Gambit {
     }
 
 
+    /// @brief Ancestry flags for every particle in a Pythia8 event, computed in one pass.
+    ///
+    /// Answers the same questions as fromBottom, fromTau and fromHadron, but each
+    /// particle's mother chain is only walked once per event rather than once per
+    /// query, after which every lookup is a table access.
+    class Py8Ancestry {
+    public:
+
+      /// Bits stored for each particle
+      enum Flags { FROM_BOTTOM = 1, FROM_TAU = 2, FROM_HADRON = 4 };
+
+      Py8Ancestry() { }
+      explicit Py8Ancestry(const Pythia8::Event& evt) { fill(evt); }
+
+      /// Recompute the table for a new event
+      void fill(const Pythia8::Event& evt) {
+        _flags.assign(evt.size(), 0);
+        _state.assign(evt.size(), UNKNOWN);
+        // Mothers nearly always precede their daughters, so this is effectively a single pass
+        for (int n = 0; n < evt.size(); ++n) _compute(n, evt);
+      }
+
+      /// All flags for particle n
+      unsigned char flags(int n) const { return _flags[n]; }
+      /// Equivalent to fromBottom(n, evt)
+      bool fromBottom(int n) const { return _flags[n] & FROM_BOTTOM; }
+      /// Equivalent to fromTau(n, evt)
+      bool fromTau(int n) const { return _flags[n] & FROM_TAU; }
+      /// Equivalent to fromHadron(n, evt)
+      bool fromHadron(int n) const { return _flags[n] & FROM_HADRON; }
+
+    private:
+
+      enum State : unsigned char { UNKNOWN, VISITING, DONE };
+
+      unsigned char _compute(int n, const Pythia8::Event& evt) {
+        if (_state[n] == DONE) return _flags[n];
+        // A particle met again while walking its own ancestors contributes nothing
+        if (_state[n] == VISITING) return 0;
+        _state[n] = VISITING;
+        unsigned char f = 0;
+        // Root particle is invalid
+        if (n != 0) {
+          const Pythia8::Particle& p = evt[n];
+          if (abs(p.id()) == 5 || MCUtils::PID::hasBottom(p.id())) f |= FROM_BOTTOM;
+          if (abs(p.id()) == 15) f |= FROM_TAU;
+          if (p.isHadron()) f |= FROM_HADRON;
+          // Stop walking at the end of the hadron level, as the recursive functions do
+          if (!p.isParton()) {
+            for (int m : p.motherList()) f |= _compute(m, evt);
+          }
+        }
+        _flags[n] = f;
+        _state[n] = DONE;
+        return f;
+      }
+
+      std::vector<unsigned char> _flags;
+      std::vector<State> _state;
+
+    };
+
+
     inline bool isReplica(int n, const Pythia8::Event& evt) {
       // Root particle is invalid
       if (n == 0) return false;
@@ -144,13 +144,41 @@ namespace Gambit {
     //@}
 
 
+    /// @name Batched lookups in binned maps
+    /// Results are identical to calling get_at for each position in turn, and
+    /// positions outside the binning throw the same exceptions.
+    //@{
+
+    /// Look up a 1D map at each of the positions xs, writing the values to out
+    void binned_values(const HEPUtils::BinnedFn1D<double>& fn, const std::vector<double>& xs, std::vector<double>& out);
+
+    /// Look up a 2D map at each of the positions (xs[i], ys[i]), writing the values to out
+    void binned_values(const HEPUtils::BinnedFn2D<double>& fn, const std::vector<double>& xs, const std::vector<double>& ys, std::vector<double>& out);
+
+    /// Look up a 2D |eta|-pT map for each object in a list of particles or jets
+    template <typename PTR>
+    void binned_values_etapt(const HEPUtils::BinnedFn2D<double>& fn, const std::vector<PTR>& objs, std::vector<double>& out) {
+      std::vector<double> abseta(objs.size()), pt(objs.size());
+      for (size_t i = 0; i < objs.size(); ++i) { abseta[i] = objs[i]->abseta(); pt[i] = objs[i]->pT(); }
+      binned_values(fn, abseta, pt, out);
+    }
+
+    //@}
+
+
     /// @name Random filtering by efficiency
+    /// All of these draw exactly one random number per particle, in list order,
+    /// and remove the rejected particles in a single stable pass.
     //@{
 
+    /// Utility function for filtering a supplied particle vector by sampling wrt a per-particle list of efficiencies
+    void filtereff(std::vector<HEPUtils::Particle*>& particles, const std::vector<double>& effs, bool do_delete=true);
+
     /// Utility function for filtering a supplied particle vector by sampling wrt an efficiency scalar
     void filtereff(std::vector<HEPUtils::Particle*>& particles, double eff, bool do_delete=true);
 
-    /// Utility function for filtering a supplied particle vector by sampling an efficiency returned by a provided function object
+    /// @brief Utility function for filtering a supplied particle vector by sampling an efficiency returned by a provided function object
+    /// @note eff_fn is called for every particle before any random numbers are drawn
     void filtereff(std::vector<HEPUtils::Particle*>& particles, std::function<double(HEPUtils::Particle*)> eff_fn, bool do_delete=true);
 
     /// Utility function for filtering a supplied particle vector by sampling wrt a binned 1D efficiency map in pT
@@ -11,6 +11,7 @@
 #include "gambit/ColliderBit/analyses/AnalysisData.hpp"
 
 #include "gambit/ColliderBit/Utils.hpp"
+#include "gambit/ColliderBit/EventColumns.hpp"
 #include "HEPUtils/MathUtils.h"
 #include "HEPUtils/Event.h"
 
@@ -23,6 +24,7 @@
 #include <memory>
 #include <iomanip>
 #include <algorithm>
+#include <chrono>
 
 namespace Gambit {
   namespace ColliderBit {
@@ -35,20 +37,24 @@ namespace Gambit {
     private:
 
       double _ntot, _xsec, _xsecerr, _luminosity;
+      double _analysis_time;
       bool _xsec_is_set, _luminosity_is_set, _is_scaled;
       bool _needs_collection;
       AnalysisData _results;
       typedef EventT EventType;
       std::string _analysis_name;
+      const EventColumns* _shared_columns;
+      EventColumns _own_columns;
 
     public:
 
       /// @name Construction, Destruction, and Recycling:
       //@{
 
-      BaseAnalysis() : _ntot(0), _xsec(0), _xsecerr(0), _luminosity(0),
+      BaseAnalysis() : _ntot(0), _xsec(0), _xsecerr(0), _luminosity(0), _analysis_time(0),
                        _xsec_is_set(false), _luminosity_is_set(false),
-                       _is_scaled(false), _needs_collection(true) {  }
+                       _is_scaled(false), _needs_collection(true),
+                       _shared_columns(nullptr) {  }
 
       virtual ~BaseAnalysis() { }
 
@@ -74,7 +80,7 @@ namespace Gambit {
       /// @todo For v2.0: Avoid this 'duplication' of reset/clear methods.
       void _clear() 
       { 
-        _ntot = 0; _xsec = 0; _xsecerr = 0;
+        _ntot = 0; _xsec = 0; _xsecerr = 0; _analysis_time = 0;
         _xsec_is_set = false; _is_scaled = false;
         _needs_collection = true;
         _results.clear();
@@ -87,10 +93,23 @@ namespace Gambit {
       /// Analyze the event (accessed by reference).
       void do_analysis(const EventT& e) { do_analysis(&e); }
       /// Analyze the event (accessed by pointer).
-      void do_analysis(const EventT* e) { _needs_collection = true; analyze(e); }
+      void do_analysis(const EventT* e) {
+        _needs_collection = true;
+        const auto start = std::chrono::steady_clock::now();
+        analyze(e);
+        _analysis_time += std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+      }
+      /// Analyze the event, with a columnar view of it that is shared with other analyses.
+      void do_analysis(const EventT* e, const EventColumns* cols) {
+        _shared_columns = cols;
+        do_analysis(e);
+        _shared_columns = nullptr;
+      }
 
       /// Return the total number of events seen so far.
       double num_events() const { return _ntot; }
+      /// Return the total wall-clock time spent analysing events so far (in seconds).
+      double analysis_time() const { return _analysis_time; }
       /// Return the cross-section (in pb).
       double xsec() const { return _xsec; }
       /// Return the cross-section error (in pb).
@@ -165,6 +184,14 @@ namespace Gambit {
       /// Analyze the event (accessed by pointer).
       /// @note Needs to be called from Derived::analyze().
       virtual void analyze(const EventT*) { _ntot += 1; }
+      /// Get a columnar view of the event being analysed.
+      /// @note The view passed to do_analysis is used if it describes this event; otherwise a
+      /// private one is (re)bound, so call this once per event and keep the reference.
+      const EventColumns& columns(const EventT* e) {
+        if (_shared_columns != nullptr && _shared_columns->event() == e) return *_shared_columns;
+        _own_columns.bind(*e);
+        return _own_columns;
+      }
       /// Add the given result to the internal results list.
       void add_result(const SignalRegionData& sr) { _results.add(sr); }
       /// Set the covariance matrix, expressing SR correlations
@@ -216,6 +243,7 @@ namespace Gambit {
           _results[i].n_signal += otherResults[i].n_signal;
         }
         _ntot += other->num_events();
+        _analysis_time += other->analysis_time();
       }
 
       /// Add cross-sections and errors for two different process types.
@@ -4,6 +4,7 @@
 #include <stdexcept>
 #include <vector>
 #include <map>
+#include <memory>
 
 // Forward declarations, to avoid header-chaining into CB_types.hpp
 namespace HEPUtils { class Event; }
@@ -12,6 +13,7 @@ namespace Gambit {
     template <typename EventT>
     class BaseAnalysis;
     using HEPUtilsAnalysis = BaseAnalysis<HEPUtils::Event>;
+    class EventColumns;
   }
 }
 
@@ -56,6 +58,9 @@ namespace Gambit {
         /// Key for the instances_map
         string base_key;
 
+        /// Columnar view of the event currently being analysed, shared by all analyses
+        std::shared_ptr<EventColumns> event_columns;
+
         /// A vector with pointers to all instances of this class. The key is the OMP thread number.
         /// (There should only be one instance of this class per OMP thread.)
         static std::map<string,std::map<int,HEPUtilsAnalysisContainer*> > instances_map;
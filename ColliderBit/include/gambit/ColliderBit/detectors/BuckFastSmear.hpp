@@ -5,6 +5,8 @@
 namespace Gambit {
   namespace ColliderBit {
 
+    class TruthEventCache;
+
     /// A base class for BuckFast simple smearing simulations within ColliderBit.
     struct BuckFastBase : BaseDetector<Pythia8::Event, HEPUtils::Event> {
       /// @name Event detection simulation.
@@ -17,8 +19,15 @@ namespace Gambit {
         /// A converter for a Pythia8::Event which considers only partonic final states.
         /// @note Also performs the jet clustering algorithm.
         void convertPythia8PartonEvent(const EventInType&, EventOutType&) const;
+        /// Convert a Pythia8::Event with the parton- or particle-level converter, as configured.
+        void convertPythia8Event(const EventInType&, EventOutType&) const;
+        /// Apply the detector-specific smearing and efficiencies to a converted event.
+        virtual void smearEvent(EventOutType&) const { }
         /// Perform the BuckFast simple smearing on the next collider event by reference.
-        virtual void processEvent(const EventInType&, EventOutType&) const = 0;
+        void processEvent(const EventInType&, EventOutType&) const;
+        /// Perform the BuckFast simple smearing, taking the converted event from (or adding it to) a cache
+        /// shared with the other detector simulations run on the same event.
+        void processEvent(const EventInType&, EventOutType&, TruthEventCache&) const;
       //@}
 
       /// @name Construction, Destruction, and Recycling
@@ -44,7 +53,7 @@ namespace Gambit {
     struct BuckFastSmearATLAS : BuckFastBase {
       /// @name Event detection simulation.
       //@{
-        void processEvent(const EventInType&, EventOutType&) const;
+        void smearEvent(EventOutType&) const;
       //@}
 
       /// @name Construction, Destruction, and Recycling
@@ -60,7 +69,7 @@ namespace Gambit {
     struct BuckFastSmearATLASnoeff : BuckFastBase {
       /// @name Event detection simulation.
       //@{
-        void processEvent(const EventInType&, EventOutType&) const;
+        void smearEvent(EventOutType&) const;
       //@}
 
       /// @name Construction, Destruction, and Recycling
@@ -76,7 +85,7 @@ namespace Gambit {
     struct BuckFastSmearCMS : BuckFastBase {
       /// @name Event detection simulation.
       //@{
-        void processEvent(const EventInType&, EventOutType&) const;
+        void smearEvent(EventOutType&) const;
       //@}
 
       /// @name Construction, Destruction, and Recycling
@@ -92,7 +101,7 @@ namespace Gambit {
     struct BuckFastSmearCMSnoeff : BuckFastBase {
       /// @name Event detection simulation.
       //@{
-        void processEvent(const EventInType&, EventOutType&) const;
+        void smearEvent(EventOutType&) const;
       //@}
 
       /// @name Construction, Destruction, and Recycling
@@ -105,11 +114,6 @@ namespace Gambit {
 
     /// Simple smearing functions as a detector pseudo-simulation.
     struct BuckFastIdentity : BuckFastBase {
-      /// @name Event detection simulation.
-      //@{
-        void processEvent(const EventInType&, EventOutType&) const;
-      //@}
-
       /// @name Construction, Destruction, and Recycling
       //@{
         BuckFastIdentity() { }
@@ -117,5 +121,28 @@ namespace Gambit {
       //@}
     };
 
+
+    /// @brief Converted (truth-level, jet-clustered) versions of the current Pythia event.
+    ///
+    /// Detector simulations with the same converter settings share one conversion, so
+    /// the conversion and jet clustering are done once per event however many detectors
+    /// are active. Only the detector-specific smearing is then applied to each copy.
+    class TruthEventCache {
+      public:
+        /// Forget all stored conversions; call this whenever a new event is generated.
+        void clear() { for (Entry& entry : _entries) entry.source = nullptr; }
+        /// Get the conversion of pevt made with the settings of det, converting it on first request.
+        const HEPUtils::Event& get(const BuckFastBase& det, const Pythia8::Event& pevt);
+
+      private:
+        struct Entry {
+          bool partonOnly;
+          double antiktR;
+          const Pythia8::Event* source; ///< Event this entry was converted from; null if stale
+          std::shared_ptr<HEPUtils::Event> event;
+        };
+        std::vector<Entry> _entries;
+    };
+
   }
 }
@@ -41,9 +41,11 @@
 #include <numeric>
 #include <sstream>
 #include <vector>
+#include <algorithm>
 
 #include "gambit/Elements/gambit_module_headers.hpp"
 #include "gambit/ColliderBit/MC_convergence.hpp"
+#include "gambit/ColliderBit/EventPrefetcher.hpp"
 #include "gambit/ColliderBit/ColliderBit_rollcall.hpp"
 #include "gambit/ColliderBit/analyses/BaseAnalysis.hpp"
 
@@ -75,6 +77,26 @@ namespace Gambit
     //#endif
 
 
+    namespace {
+
+      /// Log the time spent by each analysis in a container on the current collider, slowest first
+      void logAnalysisTiming(const HEPUtilsAnalysisContainer& container, const str& detector)
+      {
+        std::vector<std::pair<double,str> > times;
+        for (auto& analysis_pointer_pair : container.get_current_analyses_map())
+        {
+          times.push_back(std::make_pair(analysis_pointer_pair.second->analysis_time(), analysis_pointer_pair.first));
+        }
+        std::sort(times.rbegin(), times.rend());
+        std::stringstream ss;
+        ss << detector << " analysis timing for collider " << container.get_current_collider() << " (seconds, summed over threads):";
+        for (auto& time_name_pair : times) ss << endl << "  " << time_name_pair.second << ": " << time_name_pair.first;
+        logger() << LogTags::debug << ss.str() << EOM;
+      }
+
+    }
+
+
 
     /// Module-wide variables
     /// @{
@@ -100,6 +122,11 @@ namespace Gambit
     int nFailedEvents;
     int maxFailedEvents;
     int seedBase;
+    /// Pipeline mode: generate each thread's next event on a helper thread while the current one is analysed
+    bool pipelineGeneration;
+    std::vector<std::unique_ptr<EventPrefetcher<Pythia8::Event> > > pythiaPrefetchers;
+    /// Converted versions of each thread's current event, shared by the BuckFast detector simulations
+    thread_local TruthEventCache truthEventCache;
 
     /// Analysis stuff
     bool useBuckFastATLASDetector;
@@ -119,6 +146,160 @@ namespace Gambit
 
     /// @}
 
+    namespace {
+
+      /// Background-only quantities for analyses with SR covariance information.
+      /// These depend only on fixed experimental inputs, so are computed once per
+      /// scan (keyed on analysis name) and shared by all subsequent points.
+      struct BkgOnlyCovarianceData
+      {
+        Eigen::ArrayXd sqrtEb;
+        Eigen::MatrixXd Vb;
+        long double like_b;
+      };
+      std::map<str,BkgOnlyCovarianceData> bkgOnlyCovarianceCache;
+
+    }
+
+
+    /// Number of samples drawn together in each block by sum_covariance_sampled_likes
+    const size_t COVARIANCE_SAMPLE_BLOCKSIZE = 1024;
+
+    /// Sample NSAMPLE sets of correlated SR rates from a Gaussian with
+    /// eigenvalue square roots sqrtE and rotation V, offset by the mean rates
+    /// n_pred, and return the sum of the corresponding Poisson likelihoods.
+    ///
+    /// Samples are drawn in fixed-size blocks, each from its own counter-based
+    /// random stream (numbered from first_stream) of the sequence identified by
+    /// seed, and the block sums are added up in block order. The result is
+    /// therefore reproducible for a given seed, independent of the number of
+    /// OpenMP threads. On return, first_stream is advanced past the streams used. Within a block, the rotation
+    /// is applied to all samples as a single matrix product, and the Poisson
+    /// log terms are evaluated with Eigen's vectorised array operations.
+    long double sum_covariance_sampled_likes(const Eigen::ArrayXd& n_obs, const Eigen::ArrayXd& logfact_n_obs,
+                                             const Eigen::ArrayXd& n_pred, const Eigen::ArrayXd& sqrtE,
+                                             const Eigen::MatrixXd& V, size_t NSAMPLE,
+                                             Utils::counter_rng::result_type seed,
+                                             Utils::counter_rng::result_type& first_stream)
+    {
+      const size_t nSR = n_obs.size();
+      const size_t nblocks = (NSAMPLE + COVARIANCE_SAMPLE_BLOCKSIZE - 1) / COVARIANCE_SAMPLE_BLOCKSIZE;
+      const double sum_logfact_n_obs = logfact_n_obs.sum();
+      const Eigen::RowVectorXd n_obs_row = n_obs.matrix().transpose();
+
+      // Fold the eigenvalue scaling into the rotation, so each block needs just one matrix product
+      const Eigen::MatrixXd Vscaled = V * sqrtE.matrix().asDiagonal();
+
+      // Claim a stream for each block of this batch
+      const Utils::counter_rng::result_type stream0 = first_stream;
+      first_stream += nblocks;
+      std::vector<long double> block_lsums(nblocks, 0);
+
+      /// @note How to correct negative rates? Discard (scales badly), set to
+      /// epsilon (= discontinuous & unphysical pdf), transform to log-space
+      /// (distorts the pdf quite badly), or something else (skew term)?
+      /// We're using the "set to epsilon" version for now.
+      /// Ben: I would vote for 'discard'. It can't be that inefficient, surely?
+      ///
+      /// @todo Add option for normal sampling in log(rate), i.e. "multidimensional log-normal"
+      #pragma omp parallel
+      {
+        std::normal_distribution<double> unitnormdbn(0,1);
+        Eigen::MatrixXd norm_samples(nSR, COVARIANCE_SAMPLE_BLOCKSIZE);
+        Eigen::MatrixXd n_pred_samples(nSR, COVARIANCE_SAMPLE_BLOCKSIZE);
+
+        #pragma omp for schedule(dynamic)
+        for (size_t k = 0; k < nblocks; ++k)
+        {
+          const size_t nk = std::min(COVARIANCE_SAMPLE_BLOCKSIZE, NSAMPLE - k*COVARIANCE_SAMPLE_BLOCKSIZE);
+          Utils::counter_rng block_rng(seed, stream0 + k);
+          unitnormdbn.reset();
+
+          // Draw the whole block of unit normals from this block's stream
+          double* z = norm_samples.data();
+          for (size_t n = 0; n < nk*nSR; ++n) z[n] = unitnormdbn(block_rng);
+
+          // Rotate rate deltas into the SR basis and shift by SR mean rates
+          auto lambda = n_pred_samples.leftCols(nk);
+          lambda.noalias() = Vscaled * norm_samples.leftCols(nk);
+          lambda.colwise() += n_pred.matrix();
+          lambda = lambda.cwiseMax(1e-3); //< manually avoid <= 0 rates
+
+          // Calculate Poisson likelihoods for all samples and add to the block sum
+          const Eigen::ArrayXd combined_loglikes = (n_obs_row * lambda.array().log().matrix()
+                                                    - lambda.colwise().sum()).array().transpose() - sum_logfact_n_obs;
+          block_lsums[k] = combined_loglikes.exp().sum();
+        }
+      } // End omp parallel
+
+      long double lsum = 0;
+      for (const long double& block_lsum : block_lsums) lsum += block_lsum;
+      return lsum;
+    }
+
+
+    /// Compute the covariance-marginalised likelihood by MC sampling, doubling the
+    /// number of samples until two independent estimates agree to within the
+    /// absolute or relative tolerance. Samples are drawn from the random streams
+    /// of seed starting at next_stream, which is advanced past the streams used.
+    long double marg_like_covariance(const Eigen::ArrayXd& n_obs, const Eigen::ArrayXd& logfact_n_obs,
+                                     const Eigen::ArrayXd& n_pred, const Eigen::ArrayXd& sqrtE,
+                                     const Eigen::MatrixXd& V, size_t nsample_start,
+                                     double tol_abs, double tol_rel,
+                                     Utils::counter_rng::result_type seed,
+                                     Utils::counter_rng::result_type& next_stream)
+    {
+      size_t NSAMPLE = nsample_start;
+
+      // Dynamic convergence control & test variables
+      bool first_iteration = true;
+      double diff_abs = 9999;
+      double diff_rel = 1;
+
+      // Likelihood variables (note use of long double to guard against blow-up of L as opposed to log(L1/L0))
+      long double ana_like_prev = 1;
+      long double ana_like = 1;
+      long double lsum_prev = 0;
+
+      while ((diff_abs > tol_abs && diff_rel > tol_rel) || 1.0/sqrt(NSAMPLE) > tol_abs)
+      {
+        const long double lsum = sum_covariance_sampled_likes(n_obs, logfact_n_obs, n_pred, sqrtE, V, NSAMPLE, seed, next_stream);
+
+        // Compare convergence to previous independent batch
+        if (first_iteration)  // The first round must be generated twice
+        {
+          lsum_prev = lsum;
+          first_iteration = false;
+        }
+        else
+        {
+          ana_like_prev = lsum_prev / (double)NSAMPLE;
+          ana_like = lsum / (double)NSAMPLE;
+          diff_abs = fabs(ana_like_prev - ana_like);
+          diff_rel = diff_abs/ana_like;
+
+          // Update variables
+          lsum_prev += lsum;  // Aggregate result. This doubles the effective batch size for lsum_prev.
+          NSAMPLE *= 2;  // This ensures that the next batch for lsum is as big as the current batch size for lsum_prev, so they can be compared directly.
+        }
+
+        #ifdef COLLIDERBIT_DEBUG
+        cout << debug_prefix()
+             << "diff_rel: " << diff_rel << endl
+             << "   diff_abs: " << diff_abs << endl
+             << "   logl_prev: " << log(ana_like_prev) << endl
+             << "   logl: " << log(ana_like) << endl;
+        cout << debug_prefix() << "NSAMPLE for the next iteration is: " << NSAMPLE << endl;
+        cout << debug_prefix() << endl;
+        #endif
+      }
+
+      // Combine the independent estimates ana_like and ana_like_prev.
+      // Use equal weights since the estimates are based on equal batch sizes.
+      return 0.5*(ana_like + ana_like_prev);
+    }
+
+
     // *************************************************
     // Rollcalled functions properly hooked up to Gambit
     // *************************************************
@@ -200,6 +381,17 @@ namespace Gambit
       // Allow the user to specify the Pythia seed base (for debugging). If the default value -1
       // is used, a new seed is generated for every new Pythia configuration and parameter point.
       int yaml_seedBase = runOptions->getValueOrDef<int>(-1, "pythiaSeedBase");
+      // Should each thread generate its next event in the background while the current one is
+      // smeared and analysed? This uses one extra (mostly busy) thread per OpenMP thread.
+      pipelineGeneration = runOptions->getValueOrDef<bool>(false, "pipelineGeneration");
+      if (pipelineGeneration)
+      {
+        pythiaPrefetchers.resize(omp_get_max_threads());
+        for (auto& prefetcher : pythiaPrefetchers)
+        {
+          if (!prefetcher) prefetcher.reset(new EventPrefetcher<Pythia8::Event>);
+        }
+      }
 
       // Check that length of pythiaNames and nEvents agree!
       if (pythiaNames.size() != Dep::MC_ConvergenceSettings->min_nEvents.size())
@@ -259,7 +451,6 @@ namespace Gambit
         #ifdef COLLIDERBIT_DEBUG
         cout << debug_prefix() << "operateLHCLoop: Will execute START_SUBPROCESS";
         #endif
-        int currentEvent = 0;
         #pragma omp parallel
         {
           Loop::executeIteration(START_SUBPROCESS);
@@ -268,65 +459,111 @@ namespace Gambit
         piped_warnings.check(ColliderBit_warning());
         piped_errors.check(ColliderBit_error());
 
-        // Convergence loop
-        while(currentEvent < max_nEvents and not *Loop::done)
-        {
-          int eventCountBetweenConvergenceChecks = 0;
+        // Event tickets handed out so far, number of events completed, and the last
+        // convergence epoch (block of stoppingres completed events) that has been checked.
+        int nextEventTicket = 0;
+        int currentEvent = 0;
+        int lastCheckedEpoch = 0;
 
-          #ifdef COLLIDERBIT_DEBUG
-          cout << debug_prefix() << "Starting main event loop.  Will do " << stoppingres << " events before testing convergence." << endl;
-          #endif
+        // Held by the thread currently running a convergence check
+        omp_lock_t convergenceCheckLock;
+        omp_init_lock(&convergenceCheckLock);
+
+        #ifdef COLLIDERBIT_DEBUG
+        cout << debug_prefix() << "Starting main event loop.  Will test convergence every " << stoppingres << " events." << endl;
+        #endif
+
+        // Main event loop.  A single thread team runs for the whole collider.  Each thread
+        // takes the next event number from a shared atomic ticket counter, so threads that
+        // happen to generate faster events simply process more of them.  When the number of
+        // completed events crosses a multiple of stoppingres, each thread publishes its own
+        // convergence data as it passes, without locking.  Whenever an epoch has not yet been
+        // checked, the next thread to finish an event runs the convergence check, unless
+        // another thread is already doing so, in which case it just carries on.  No thread ever
+        // waits for another; the check ends the loop by setting the done flag polled below.
+        #pragma omp parallel
+        {
+          int myLastPublishedEpoch = 0;
 
-          // Main event loop
-          #pragma omp parallel
+          while(not *Loop::done and
+                not piped_errors.inquire() and
+                nFailedEvents <= maxFailedEvents)
           {
-            while(eventCountBetweenConvergenceChecks < stoppingres and
-                  currentEvent < max_nEvents and
+            // Take a ticket for the next event
+            int myEvent;
+            #pragma omp atomic capture
+            myEvent = nextEventTicket++;
+            if (myEvent >= max_nEvents) break;
+
+            if (!eventsGenerated) eventsGenerated = true;
+
+            // Generate and analyse the event, retrying the same event number if it is vetoed
+            bool eventDone = false;
+            while(not eventDone and
                   not *Loop::done and
                   not piped_errors.inquire() and
                   nFailedEvents <= maxFailedEvents)
             {
-              if (!eventsGenerated) eventsGenerated = true;
               try
               {
-                Loop::executeIteration(currentEvent);
-                currentEvent++;
-                eventCountBetweenConvergenceChecks++;
+                Loop::executeIteration(myEvent);
+                eventDone = true;
               }
               catch (std::domain_error& e)
               {
                 cout << "\n   Continuing to the next event...\n\n";
               }
             }
-          }
-          // Any problems during the main event loop?
-          piped_warnings.check(ColliderBit_warning());
-          piped_errors.check(ColliderBit_error());
+            if (not eventDone) break;
 
-          #ifdef COLLIDERBIT_DEBUG
-          cout << debug_prefix() << "Did " << eventCountBetweenConvergenceChecks << " events of " << currentEvent << " simulated so far." << endl;
-          #endif
+            int nCompleted;
+            #pragma omp atomic capture
+            nCompleted = ++currentEvent;
 
-          // Break convergence loop if too many events fail
-          if(nFailedEvents > maxFailedEvents) break;
+            // Don't bother with convergence stuff if we haven't passed the minimum number of events yet
+            if (nCompleted < min_nEvents) continue;
 
-          // Don't bother with convergence stuff if we haven't passed the minimum number of events yet
-          if (currentEvent >= min_nEvents)
-          {
-            #pragma omp parallel
+            // Publish this thread's convergence data for each new epoch
+            const int epoch = nCompleted / stoppingres;
+            if (epoch > myLastPublishedEpoch)
             {
+              myLastPublishedEpoch = epoch;
               Loop::executeIteration(COLLECT_CONVERGENCE_DATA);
             }
-            // Any problems during the COLLECT_CONVERGENCE_DATA step?
-            piped_warnings.check(ColliderBit_warning());
-            piped_errors.check(ColliderBit_error());
-
-            Loop::executeIteration(CHECK_CONVERGENCE);
-            // Any problems during the CHECK_CONVERGENCE step?
-            piped_warnings.check(ColliderBit_warning());
-            piped_errors.check(ColliderBit_error());
+
+            // Run the convergence check if this epoch has not been checked yet and no other thread is checking
+            int checkedEpoch;
+            #pragma omp atomic read
+            checkedEpoch = lastCheckedEpoch;
+            if (epoch <= checkedEpoch or not omp_test_lock(&convergenceCheckLock)) continue;
+            if (epoch > lastCheckedEpoch)
+            {
+              #ifdef COLLIDERBIT_DEBUG
+              cout << debug_prefix() << "Checking convergence after " << nCompleted << " events." << endl;
+              #endif
+              Loop::executeIteration(CHECK_CONVERGENCE);
+              #pragma omp atomic write
+              lastCheckedEpoch = epoch;
+            }
+            omp_unset_lock(&convergenceCheckLock);
           }
         }
+        omp_destroy_lock(&convergenceCheckLock);
+
+        // Stop any background event generation before the Pythia instances are used again.
+        // Events still being generated when the loop finished are discarded.
+        if (pipelineGeneration)
+        {
+          for (auto& prefetcher : pythiaPrefetchers) prefetcher->stop();
+        }
+
+        // Any problems during the main event loop?
+        piped_warnings.check(ColliderBit_warning());
+        piped_errors.check(ColliderBit_error());
+
+        #ifdef COLLIDERBIT_DEBUG
+        cout << debug_prefix() << "Did " << currentEvent << " events in total." << endl;
+        #endif
 
         // Store the number of generated events
         colliderInfo[*iterPythiaNames]["final_event_count"] = currentEvent;  // Will be updated later
@@ -1026,6 +1263,7 @@ namespace Gambit
       if (*Loop::iteration == COLLIDER_FINALIZE)
       {
         result.collect_and_add_signal();
+        logAnalysisTiming(result, "ATLAS");
         result.collect_and_improve_xsec();
         result.scale();
         return;
@@ -1128,6 +1366,7 @@ namespace Gambit
       if (*Loop::iteration == COLLIDER_FINALIZE)
       {
         result.collect_and_add_signal();
+        logAnalysisTiming(result, "ATLASnoeff");
         result.collect_and_improve_xsec();
         result.scale();
         return;
@@ -1230,6 +1469,7 @@ namespace Gambit
       if (*Loop::iteration == COLLIDER_FINALIZE)
       {
         result.collect_and_add_signal();
+        logAnalysisTiming(result, "CMS");
         result.collect_and_improve_xsec();
         result.scale();
         return;
@@ -1331,6 +1571,7 @@ namespace Gambit
       if (*Loop::iteration == COLLIDER_FINALIZE)
       {
         result.collect_and_add_signal();
+        logAnalysisTiming(result, "CMSnoeff");
         result.collect_and_improve_xsec();
         result.scale();
         return;
@@ -1433,6 +1674,7 @@ namespace Gambit
       if (*Loop::iteration == COLLIDER_FINALIZE)
       {
         result.collect_and_add_signal();
+        logAnalysisTiming(result, "Identity");
         result.collect_and_improve_xsec();
         result.scale();
         return;
@@ -1449,12 +1691,26 @@ namespace Gambit
 
       if (*Loop::iteration <= BASE_INIT) return;
       result.clear();
+      truthEventCache.clear();
+
+      // In pipeline mode, events come from this thread's background generator, which runs one event ahead
+      EventPrefetcher<Pythia8::Event>* prefetcher = nullptr;
+      if (pipelineGeneration)
+      {
+        prefetcher = pythiaPrefetchers.at(omp_get_thread_num()).get();
+        if (!prefetcher->running())
+        {
+          const SpecializablePythia* sim = &(*Dep::HardScatteringSim);
+          prefetcher->start([sim](Pythia8::Event& event) { sim->nextEvent(event); });
+        }
+      }
 
       while(nFailedEvents <= maxFailedEvents)
       {
         try
         {
-          Dep::HardScatteringSim->nextEvent(result);
+          if (prefetcher) prefetcher->next(result);
+          else Dep::HardScatteringSim->nextEvent(result);
           break;
         }
         catch (SpecializablePythia::EventGenerationError& e)
@@ -1492,10 +1748,10 @@ namespace Gambit
       if (*Loop::iteration <= BASE_INIT or !useBuckFastATLASDetector) return;
       result.clear();
 
-      // Get the next event from Pythia8, convert to HEPUtils::Event, and smear it
+      // Convert the Pythia8 event to a HEPUtils::Event (sharing the conversion with any other active detectors) and smear it
       try
       {
-        (*Dep::SimpleSmearingSim).processEvent(*Dep::HardScatteringEvent, result);
+        (*Dep::SimpleSmearingSim).processEvent(*Dep::HardScatteringEvent, result, truthEventCache);
       }
       catch (Gambit::exception& e)
       {
@@ -1524,10 +1780,10 @@ namespace Gambit
       if (*Loop::iteration <= BASE_INIT or !useBuckFastATLASnoeffDetector) return;
       result.clear();
 
-      // Get the next event from Pythia8, convert to HEPUtils::Event, and smear it
+      // Convert the Pythia8 event to a HEPUtils::Event (sharing the conversion with any other active detectors) and smear it
       try
       {
-        (*Dep::SimpleSmearingSim).processEvent(*Dep::HardScatteringEvent, result);
+        (*Dep::SimpleSmearingSim).processEvent(*Dep::HardScatteringEvent, result, truthEventCache);
       }
       catch (Gambit::exception& e)
       {
@@ -1556,10 +1812,10 @@ namespace Gambit
       if (*Loop::iteration <= BASE_INIT or !useBuckFastCMSDetector) return;
       result.clear();
 
-      // Get the next event from Pythia8, convert to HEPUtils::Event, and smear it
+      // Convert the Pythia8 event to a HEPUtils::Event (sharing the conversion with any other active detectors) and smear it
       try
       {
-        (*Dep::SimpleSmearingSim).processEvent(*Dep::HardScatteringEvent, result);
+        (*Dep::SimpleSmearingSim).processEvent(*Dep::HardScatteringEvent, result, truthEventCache);
       }
       catch (Gambit::exception& e)
       {
@@ -1588,10 +1844,10 @@ namespace Gambit
       if (*Loop::iteration <= BASE_INIT or !useBuckFastCMSnoeffDetector) return;
       result.clear();
 
-      // Get the next event from Pythia8, convert to HEPUtils::Event, and smear it
+      // Convert the Pythia8 event to a HEPUtils::Event (sharing the conversion with any other active detectors) and smear it
       try
       {
-        (*Dep::SimpleSmearingSim).processEvent(*Dep::HardScatteringEvent, result);
+        (*Dep::SimpleSmearingSim).processEvent(*Dep::HardScatteringEvent, result, truthEventCache);
       }
       catch (Gambit::exception& e)
       {
@@ -1620,10 +1876,10 @@ namespace Gambit
       if (*Loop::iteration <= BASE_INIT or !useBuckFastIdentityDetector) return;
       result.clear();
 
-      // Get the next event from Pythia8 and convert to HEPUtils::Event
+      // Convert the Pythia8 event to a HEPUtils::Event (sharing the conversion with any other active detectors)
       try
       {
-        (*Dep::SimpleSmearingSim).processEvent(*Dep::HardScatteringEvent, result);
+        (*Dep::SimpleSmearingSim).processEvent(*Dep::HardScatteringEvent, result, truthEventCache);
       }
       catch (Gambit::exception& e)
       {
@@ -2168,6 +2424,13 @@ namespace Gambit
       // Clear the result map
       result.clear();
 
+      // Single draw from the GAMBIT RNG per point, to key the random streams used for
+      // covariance marginalisation.  Every batch of samples for every analysis uses its
+      // own streams of this sequence, so the results depend only on this seed.
+      const Utils::counter_rng::result_type covariance_seed = Random::rng()();
+      Utils::counter_rng::result_type covariance_stream = 0;
+      logger() << LogTags::debug << "calc_LHC_LogLikes: covariance marginalisation seed " << covariance_seed << EOM;
+
       // Loop over analyses and calculate the observed dLL for each
       for (size_t analysis = 0; analysis < Dep::AllAnalysisNumbers->size(); ++analysis)
       {
@@ -2304,209 +2567,48 @@ namespace Gambit
             abs_unc_s(SR) = HEPUtils::add_quad(abs_uncertainty_s_stat, abs_uncertainty_s_sys);
           }
 
-          // Diagonalise the background-only covariance matrix, extracting the rotation matrix
-          /// @todo No need to recompute the background-only covariance decomposition for every point!
-          /// Ben: Actually don't need to recompute the background-only marginalisation at all. It
-          ///      is always the same, so can just do it once at the start of the scan.
-          const Eigen::SelfAdjointEigenSolver<Eigen::MatrixXd> eig_b(adata.srcov);
-          const Eigen::ArrayXd Eb = eig_b.eigenvalues();
-          const Eigen::ArrayXd sqrtEb = Eb.sqrt();
-          const Eigen::MatrixXd Vb = eig_b.eigenvectors();
-          //const Eigen::MatrixXd Vbinv = Vb.inverse();
-
-          // Construct and diagonalise the s+b covariance matrix, adding the diagonal signal uncertainties in quadrature
-          /// @todo Is this the best way, or should we just sample the s numbers independently and then be able to completely cache the cov matrix diagonalisation?
-          const Eigen::MatrixXd srcov_s = abs_unc_s.array().square().matrix().asDiagonal();
-          const Eigen::MatrixXd srcov_sb = adata.srcov + srcov_s;
-          const Eigen::SelfAdjointEigenSolver<Eigen::MatrixXd> eig_sb(srcov_sb);
-          const Eigen::ArrayXd Esb = eig_sb.eigenvalues();
-          const Eigen::ArrayXd sqrtEsb = Esb.sqrt();
-          const Eigen::MatrixXd Vsb = eig_sb.eigenvectors();
-          //const Eigen::MatrixXd Vsbinv = Vsb.inverse();
-
-          ///////////////////
-          /// @todo Split this whole chunk off into a lnlike-style utility function?
-
           // Sample correlated SR rates from a rotated Gaussian defined by the covariance matrix and offset by the mean rates
           static const double CONVERGENCE_TOLERANCE_ABS = runOptions->getValueOrDef<double>(0.05, "covariance_marg_convthres_abs");
           static const double CONVERGENCE_TOLERANCE_REL = runOptions->getValueOrDef<double>(0.05, "covariance_marg_convthres_rel");
           static const size_t nsample_input = runOptions->getValueOrDef<size_t>(100000, "covariance_nsamples_start");
-          size_t NSAMPLE = nsample_input;
-
-          // Dynamic convergence control & test variables
-          bool first_iteration = true;
-          double diff_abs = 9999;
-          double diff_rel = 1;
-
-          // Likelihood variables (note use of long double to guard against blow-up of L as opposed to log(L1/L0))
-          long double ana_like_b_prev = 1;
-          long double ana_like_sb_prev = 1;
-          long double ana_like_b = 1;
-          long double ana_like_sb = 1;
-          long double lsum_b_prev = 0;
-          long double lsum_sb_prev = 0;
-
-          std::normal_distribution<double> unitnormdbn(0,1);
- 
-          // Check absolute difference between independent estimates
-          /// @todo Should also implement a check of relative difference
-          while ((diff_abs > CONVERGENCE_TOLERANCE_ABS && diff_rel > CONVERGENCE_TOLERANCE_REL) || 1.0/sqrt(NSAMPLE) > CONVERGENCE_TOLERANCE_ABS)
-          {
-            long double lsum_b = 0;
-            long double lsum_sb = 0;
-
-            // typedef Eigen::Array<long double, Eigen::Dynamic, 1> ArrayXld;
-
-            /// @note How to correct negative rates? Discard (scales badly), set to
-            /// epsilon (= discontinuous & unphysical pdf), transform to log-space
-            /// (distorts the pdf quite badly), or something else (skew term)?
-            /// We're using the "set to epsilon" version for now.
-            /// Ben: I would vote for 'discard'. It can't be that inefficient, surely?
-            ///
-            /// @todo Add option for normal sampling in log(rate), i.e. "multidimensional log-normal"
 
-            const bool COVLOGNORMAL = false;
-            if (!COVLOGNORMAL)
-            {
-
-              #pragma omp parallel
-              {
-                double lsum_b_private  = 0;
-                double lsum_sb_private = 0;
-
-                // Sample correlated SR rates from a rotated Gaussian defined by the covariance matrix and offset by the mean rates
-                #pragma omp for nowait
-                for (size_t i = 0; i < NSAMPLE; ++i) {
-
-                  Eigen::VectorXd norm_sample_b(adata.size()), norm_sample_sb(adata.size());
-                  for (size_t j = 0; j < adata.size(); ++j) {
-                    norm_sample_b(j) = sqrtEb(j) * unitnormdbn(Random::rng());
-                    norm_sample_sb(j) = sqrtEsb(j) * unitnormdbn(Random::rng());
-                   }
-
-                  // Rotate rate deltas into the SR basis and shift by SR mean rates
-                  const Eigen::VectorXd n_pred_b_sample  = n_pred_b + (Vb*norm_sample_b).array();
-                  const Eigen::VectorXd n_pred_sb_sample = n_pred_sb + (Vsb*norm_sample_sb).array();
-
-                  // Calculate Poisson likelihood and add to composite likelihood calculation
-                  double combined_loglike_b = 0;
-                  double combined_loglike_sb = 0;
-                  for (size_t j = 0; j < adata.size(); ++j) {
-                    const double lambda_b_j = std::max(n_pred_b_sample(j), 1e-3); //< manually avoid <= 0 rates
-                    const double lambda_sb_j = std::max(n_pred_sb_sample(j), 1e-3); //< manually avoid <= 0 rates
-                    const double loglike_b_j  = n_obs(j)*log(lambda_b_j) - lambda_b_j - logfact_n_obs(j);
-                    const double loglike_sb_j = n_obs(j)*log(lambda_sb_j) - lambda_sb_j - logfact_n_obs(j);
-                    combined_loglike_b  += loglike_b_j;
-                    combined_loglike_sb += loglike_sb_j;
-                  }
-                  // Add combined likelihood to running sums (to later calculate averages)
-                  lsum_b_private  += exp(combined_loglike_b);
-                  lsum_sb_private += exp(combined_loglike_sb);
-                }
-                #pragma omp critical
-                {
-                  lsum_b  += lsum_b_private;
-                  lsum_sb += lsum_sb_private;
-                }
-              } // End omp parallel
-            }  // End if !COVLOGNORMAL
-
-            // /// @todo Check that this log-normal sampling works as expected.
-            // else // COVLOGNORMAL
-            // {
-
-            //   const Eigen::ArrayXd ln_n_pred_b = n_pred_b.log();
-            //   const Eigen::ArrayXd ln_n_pred_sb = n_pred_sb.log();
-            //   const Eigen::ArrayXd ln_sqrtEb = (n_pred_b + sqrtEb).log() - ln_n_pred_b;
-            //   const Eigen::ArrayXd ln_sqrtEsb = (n_pred_sb + sqrtEsb).log() - ln_n_pred_sb;
-
-            //   #pragma omp parallel
-            //   {
-            //     std::normal_distribution<> unitnormdbn{0,1};
-            //     Eigen::ArrayXd llrsums_private = Eigen::ArrayXd::Zero(adata.size());
-
-            //     #pragma omp for nowait
-
-            //     // Sample correlated SR rates from a rotated Gaussian defined by the covariance matrix and offset by the mean rates
-            //     for (size_t i = 0; i < NSAMPLE; ++i) {
-            //       Eigen::VectorXd ln_norm_sample_b(adata.size()), ln_norm_sample_sb(adata.size());
-            //       for (size_t j = 0; j < adata.size(); ++j) {
-            //         ln_norm_sample_b(j) = ln_sqrtEb(j) * unitnormdbn(Random::rng());
-            //         ln_norm_sample_sb(j) = ln_sqrtEsb(j) * unitnormdbn(Random::rng());
-            //       }
-
-            //       // Rotate rate deltas into the SR basis and shift by SR mean rates
-            //       const Eigen::ArrayXd delta_ln_n_pred_b_sample = Vb*ln_norm_sample_b;
-            //       const Eigen::ArrayXd delta_ln_n_pred_sb_sample = Vsb*ln_norm_sample_sb;
-            //       const Eigen::ArrayXd n_pred_b_sample = (ln_n_pred_b + delta_ln_n_pred_b_sample).exp();
-            //       const Eigen::ArrayXd n_pred_sb_sample = (ln_n_pred_sb + delta_ln_n_pred_sb_sample).exp();
-
-            //       // Calculate Poisson LLR and add to aggregated LL calculation
-            //       for (size_t j = 0; j < adata.size(); ++j) {
-            //         const double lambda_b_j = std::max(n_pred_b_sample(j), 1e-3); //< shouldn't be needed in log-space sampling
-            //         const double lambda_sb_j = std::max(n_pred_sb_sample(j), 1e-3); //< shouldn't be needed in log-space sampling
-            //         const double llr_j = n_obs(j)*log(lambda_sb_j/lambda_b_j) - (lambda_sb_j - lambda_b_j);
-            //         llrsums_private(j) += llr_j;
-            //       }
-            //     }
-
-            //     #pragma omp critical
-            //     {
-            //       for (size_t j = 0; j < adata.size(); ++j) { llrsums(j) += llrsums_private(j); }
-            //     }
-            //   } // End omp parallel
-            // }
-
-            // Compare convergence to previous independent batch
-            if (first_iteration)  // The first round must be generated twice
-            {
-              lsum_b_prev = lsum_b;
-              lsum_sb_prev = lsum_sb;
-              first_iteration = false;
-            }
-            else
-            {
-              ana_like_b_prev = lsum_b_prev / (double)NSAMPLE;
-              ana_like_sb_prev = lsum_sb_prev / (double)NSAMPLE;
-              ana_like_b = lsum_b / (double)NSAMPLE;
-              ana_like_sb = lsum_sb / (double)NSAMPLE;
-              //
-              const double diff_abs_b = fabs(ana_like_b_prev - ana_like_b);
-              const double diff_abs_sb = fabs(ana_like_sb_prev - ana_like_sb);
-              const double diff_rel_b = diff_abs_b/ana_like_b;
-              const double diff_rel_sb = diff_abs_sb/ana_like_sb;
-              //
-              diff_rel = std::max(diff_rel_b, diff_rel_sb);  // Relative convergence check
-              diff_abs = std::max(diff_abs_b, diff_abs_sb);  // Absolute convergence check
-
-              // Update variables
-              lsum_b_prev += lsum_b;  // Aggregate result. This doubles the effective batch size for lsum_prev.
-              lsum_sb_prev += lsum_sb;  // Aggregate result. This doubles the effective batch size for lsum_prev.
-              NSAMPLE *=2;  // This ensures that the next batch for lsum is as big as the current batch size for lsum_prev, so they can be compared directly.
-            }
+          // Diagonalise the background-only covariance matrix and marginalise the background-only
+          // likelihood over it. Both are fixed by the experimental inputs, so only do this the first
+          // time the analysis is seen, and reuse the cached values for all later points.
+          auto bkg_it = bkgOnlyCovarianceCache.find(adata.analysis_name);
+          if (bkg_it == bkgOnlyCovarianceCache.end())
+          {
+            BkgOnlyCovarianceData bkg;
+            const Eigen::SelfAdjointEigenSolver<Eigen::MatrixXd> eig_b(adata.srcov);
+            bkg.sqrtEb = eig_b.eigenvalues().array().sqrt();
+            bkg.Vb = eig_b.eigenvectors();
+            bkg.like_b = marg_like_covariance(n_obs, logfact_n_obs, n_pred_b, bkg.sqrtEb, bkg.Vb,
+                                              nsample_input, CONVERGENCE_TOLERANCE_ABS, CONVERGENCE_TOLERANCE_REL,
+                                              covariance_seed, covariance_stream);
+            bkg_it = bkgOnlyCovarianceCache.emplace(adata.analysis_name, std::move(bkg)).first;
 
             #ifdef COLLIDERBIT_DEBUG
-              cout << debug_prefix()
-                   << "diff_rel: " << diff_rel << endl
-                   <<  "   diff_abs: " << diff_abs << endl
-                   << "   ana_llr_prev: " << log(ana_like_sb_prev/ana_like_b_prev) << endl
-                   << "   ana_dll: " << log(ana_like_sb/ana_like_b) << endl
-                   << "   logl_sb: " << log(ana_like_sb) << endl
-                   << "   logl_b: " << log(ana_like_b) << endl;
-               cout << debug_prefix() << "NSAMPLE for the next iteration is: " << NSAMPLE << endl;
-              cout << debug_prefix() << endl;
+            cout << debug_prefix() << "calc_LHC_LogLikes: Cached background-only likelihood for " << adata.analysis_name << ": logl_b = " << log(bkg_it->second.like_b) << endl;
             #endif
-          }  // End while loop
+          }
+          const long double ana_like_b = bkg_it->second.like_b;
+
+          // Construct and diagonalise the s+b covariance matrix, adding the diagonal signal uncertainties in quadrature
+          /// @todo Is this the best way, or should we just sample the s numbers independently and then be able to completely cache the cov matrix diagonalisation?
+          const Eigen::MatrixXd srcov_s = abs_unc_s.array().square().matrix().asDiagonal();
+          const Eigen::MatrixXd srcov_sb = adata.srcov + srcov_s;
+          const Eigen::SelfAdjointEigenSolver<Eigen::MatrixXd> eig_sb(srcov_sb);
+          const Eigen::ArrayXd sqrtEsb = eig_sb.eigenvalues().array().sqrt();
+          const Eigen::MatrixXd Vsb = eig_sb.eigenvectors();
 
-          // Combine the independent estimates ana_like and ana_like_prev.
-          // Use equal weights since the estimates are based on equal batch sizes.
-          ana_like_b = 0.5*(ana_like_b + ana_like_b_prev);
-          ana_like_sb = 0.5*(ana_like_sb + ana_like_sb_prev);
+          const long double ana_like_sb = marg_like_covariance(n_obs, logfact_n_obs, n_pred_sb, sqrtEsb, Vsb,
+                                                          nsample_input, CONVERGENCE_TOLERANCE_ABS, CONVERGENCE_TOLERANCE_REL,
+                                                          covariance_seed, covariance_stream);
 
           // Compute LLR from mean s+b and b likelihoods
           const double ana_dll = log(ana_like_sb) - log(ana_like_b);
           #ifdef COLLIDERBIT_DEBUG
-            cout << debug_prefix() << "Combined estimate: ana_dll: " << ana_dll << "   (based on 2*NSAMPLE=" << 2*NSAMPLE << " samples)" << endl;
+            cout << debug_prefix() << "Combined estimate: ana_dll: " << ana_dll << endl;
           #endif
 
           // Check for problem
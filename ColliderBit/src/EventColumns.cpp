@@ -0,0 +1,52 @@
+#include "gambit/ColliderBit/EventColumns.hpp"
+
+namespace Gambit {
+  namespace ColliderBit {
+
+
+    void EventColumns::_do_fill() const {
+      if (_event == nullptr) {
+        _electrons.clear(); _muons.clear(); _taus.clear(); _photons.clear(); _jets.clear();
+        _met = 0; _metphi = 0;
+      } else {
+        _electrons.fill(_event->electrons());
+        _muons.fill(_event->muons());
+        _taus.fill(_event->taus());
+        _photons.fill(_event->photons());
+        _jets.fill(_event->jets());
+        _met = _event->met();
+        _metphi = _event->missingmom().phi();
+      }
+      _filled = true;
+    }
+
+
+    const Selection& EventColumns::selection(const std::string& key, const std::function<Selection()>& make) const {
+      auto it = _selections.find(key);
+      if (it != _selections.end()) return it->second;
+      // make() may itself request other memoised objects, so only insert once it has returned
+      Selection sel = make();
+      return _selections.emplace(key, std::move(sel)).first->second;
+    }
+
+
+    double EventColumns::quantity(const std::string& key, const std::function<double()>& make) const {
+      auto it = _quantities.find(key);
+      if (it != _quantities.end()) return it->second;
+      const double value = make();
+      _quantities.emplace(key, value);
+      return value;
+    }
+
+
+    Selection select_btag(const JetColumns& jets, const Selection& sel, bool btagged) {
+      Selection rtn;
+      rtn.reserve(sel.size());
+      for (size_t i : sel)
+        if (bool(jets.btag[i]) == btagged) rtn.push_back(i);
+      return rtn;
+    }
+
+
+  }
+}
@@ -30,13 +30,22 @@ namespace Gambit
   namespace ColliderBit
   {
 
+    /// Discard all counts
+    void published_signals::clear()
+    {
+      for (auto& buffer : buffers) buffer.clear();
+      back = 0;
+      front = 1;
+      middle.store(2);
+    }
+
     /// A map containing pointers to all instances of this class
     std::map<const MC_convergence_checker* const, bool> MC_convergence_checker::convergence_map;
 
     /// Constructor
     MC_convergence_checker::MC_convergence_checker() : n_threads(omp_get_max_threads()), converged(false)
     {
-      n_signals = new std::vector<int>[n_threads];
+      n_signals = new published_signals[n_threads];
       convergence_map[this] = false;
     }
 
@@ -81,36 +90,54 @@ namespace Gambit
     }
 
 
-    /// Update the convergence data.  This is the only routine meant to be called in parallel.
+    /// Update the convergence data.  May be called by each thread at any time, including
+    /// while another thread is inside achieved().
     void MC_convergence_checker::update(const HEPUtilsAnalysisContainer& ac)
     {
-      // Abort if the analysis container tracked by this object is already fully converged
-      if (converged) return;
-
       // Work out the thread number.
       int my_thread = omp_get_thread_num();
 
-      // Loop over all the analyses and populate their current signal predictions
-      n_signals[my_thread].clear();
+      // Collect the current signal predictions of all the analyses on this thread,
+      // straight into the buffer that will be handed to the convergence check
+      std::vector<int>& my_n_signals = n_signals[my_thread].next();
+      my_n_signals.clear();
       for (auto& analysis_pointer_pair : ac.get_current_analyses_map())
       {
         // Loop over all the signal regions in this analysis
         for (auto& sr : analysis_pointer_pair.second->get_results())
         {
           // Update the number of accepted events in this signal region
-          n_signals[my_thread].push_back(sr.n_signal);
+          my_n_signals.push_back(sr.n_signal);
         }
       }
+
+      // Publish them.  Once converged the counts are no longer looked at, so there is no need to check.
+      n_signals[my_thread].publish();
     }
 
 
     /// Check if convergence has been achieved across threads, and across all instances of this class
     bool MC_convergence_checker::achieved(const HEPUtilsAnalysisContainer& ac)
+    {
+      bool result;
+      #pragma omp critical (MC_convergence_checker)
+      {
+        result = achieved_unlocked(ac);
+      }
+      return result;
+    }
+
+    /// Implementation of achieved(); the caller must hold the MC_convergence_checker lock.
+    bool MC_convergence_checker::achieved_unlocked(const HEPUtilsAnalysisContainer& ac)
     {
 
       if (not converged)
       {
 
+        // Take the latest counts published by each thread
+        std::vector<const std::vector<int>*> thread_signals(n_threads);
+        for (int j = 0; j != n_threads; j++) thread_signals[j] = &n_signals[j].latest();
+
         int SR_index = -1;
         // Loop over all analyses
         bool analysis_converged;
@@ -128,12 +155,14 @@ namespace Gambit
             SR_converged = false;
             SR_index += 1;
 
-            // Sum signal count across threads
+            // Sum signal count across threads.  Threads that have not yet published any
+            // data are skipped, which can only delay (never falsely declare) convergence.
             int total_counts = 0;
             for (int j = 0; j != n_threads; j++)
             {
               // Tally up the counts across all threads
-              total_counts += n_signals[j][SR_index];
+              const std::vector<int>& counts = *thread_signals[j];
+              if (counts.size() > (size_t)SR_index) total_counts += counts[SR_index];
             }
 
             double fractional_stat_uncert = (total_counts == 0 ? 1.0 : 1.0/sqrt(total_counts));
@@ -145,7 +174,7 @@ namespace Gambit
 
             #ifdef COLLIDERBIT_DEBUG
               cerr << endl;
-              cerr << "DEBUG: SIGNAL REGION " << SR_index << " of " << n_signals[0].size() << endl;
+              cerr << "DEBUG: SIGNAL REGION " << SR_index << " of " << thread_signals[0]->size() << endl;
               cerr << "DEBUG: SR label: " << sr.sr_label << " in analysis " << analysis_pointer_pair.first << endl;
               cerr << "DEBUG: absolute_stat_uncert vs sys: " << absolute_stat_uncert << " vs " << sr.signal_sys << endl;
               cerr << "DEBUG: fractional_stat_uncert vs target: " << fractional_stat_uncert << " vs " << _settings->target_stat[_collider] << endl;
@@ -13,55 +13,102 @@ namespace Gambit {
     }
 
 
+    namespace {
+
+      /// @brief Bin indices of the positions xs, identical to calling binning.get_index on each.
+      ///
+      /// For sorted edges, the bin index of an in-range x is the number of interior
+      /// edges <= x, which is accumulated edge by edge so that the inner loop runs
+      /// over the positions and can be vectorised. Positions outside the binning
+      /// are handed to get_index, which throws exactly as for a single lookup.
+      void bin_indices(const HEPUtils::Binning1D<double>& binning, const std::vector<double>& xs, std::vector<size_t>& idx) {
+        binning.check();
+        const std::vector<double>& edges = binning.edges;
+        const size_t n = xs.size();
+        const double lo = edges.front(), hi = edges.back();
+        idx.assign(n, 0);
+        for (size_t j = 1; j+1 < edges.size(); ++j) {
+          const double edge = edges[j];
+          for (size_t i = 0; i < n; ++i) idx[i] += (edge <= xs[i]);
+        }
+        for (size_t i = 0; i < n; ++i)
+          if (!(xs[i] >= lo && xs[i] <= hi)) idx[i] = binning.get_index(xs[i]);
+      }
+
+      /// Keep particles[i] if deviates[i] < effs[i], deleting the others if requested
+      void compact(std::vector<HEPUtils::Particle*>& particles, const std::vector<double>& deviates,
+                   const std::vector<double>& effs, bool do_delete) {
+        size_t nkept = 0;
+        for (size_t i = 0; i < particles.size(); ++i) {
+          HEPUtils::Particle* p = particles[i];
+          if (deviates[i] < effs[i]) particles[nkept++] = p;
+          else if (do_delete) delete p;
+        }
+        particles.resize(nkept);
+      }
+
+    }
+
+
+    void binned_values(const HEPUtils::BinnedFn1D<double>& fn, const std::vector<double>& xs, std::vector<double>& out) {
+      fn.check();
+      std::vector<size_t> ix;
+      bin_indices(fn.binning, xs, ix);
+      out.resize(xs.size());
+      for (size_t i = 0; i < xs.size(); ++i) out[i] = fn.values[ix[i]];
+    }
+
+
+    void binned_values(const HEPUtils::BinnedFn2D<double>& fn, const std::vector<double>& xs, const std::vector<double>& ys, std::vector<double>& out) {
+      fn.check();
+      std::vector<size_t> ix, iy;
+      bin_indices(fn.binning.binningX, xs, ix);
+      bin_indices(fn.binning.binningY, ys, iy);
+      const size_t nby = fn.num_bins_y();
+      out.resize(xs.size());
+      for (size_t i = 0; i < xs.size(); ++i) out[i] = fn.values[ix[i]*nby + iy[i]];
+    }
+
+
+    void filtereff(std::vector<HEPUtils::Particle*>& particles, const std::vector<double>& effs, bool do_delete) {
+      if (particles.empty()) return;
+      std::vector<double> deviates;
+      Random::draw(deviates, particles.size());
+      compact(particles, deviates, effs, do_delete);
+    }
+
+
     void filtereff(std::vector<HEPUtils::Particle*>& particles, double eff, bool do_delete) {
       if (particles.empty()) return;
-      auto keptParticlesEnd = std::remove_if(particles.begin(), particles.end(),
-                                             [&](HEPUtils::Particle* p) {
-                                               const bool rm = !random_bool(eff);
-                                               if (do_delete && rm) delete p;
-                                               return rm;
-                                             } );
-      particles.erase(keptParticlesEnd, particles.end());
+      filtereff(particles, std::vector<double>(particles.size(), eff), do_delete);
     }
 
 
     /// Utility function for filtering a supplied particle vector by sampling wrt a binned 1D efficiency map in pT
     void filtereff(std::vector<HEPUtils::Particle*>& particles, std::function<double(HEPUtils::Particle*)> eff_fn, bool do_delete) {
       if (particles.empty()) return;
-      auto keptParticlesEnd = std::remove_if(particles.begin(), particles.end(),
-                                             [&](HEPUtils::Particle* p) {
-                                               const double eff = eff_fn(p);
-                                               const bool rm = !random_bool(eff);
-                                               if (do_delete && rm) delete p;
-                                               return rm;
-                                             } );
-      particles.erase(keptParticlesEnd, particles.end());
+      std::vector<double> effs(particles.size());
+      for (size_t i = 0; i < particles.size(); ++i) effs[i] = eff_fn(particles[i]);
+      filtereff(particles, effs, do_delete);
     }
 
 
     // Utility function for filtering a supplied particle vector by sampling wrt a binned 1D efficiency map in pT
     void filtereff_pt(std::vector<HEPUtils::Particle*>& particles, const HEPUtils::BinnedFn1D<double>& eff_pt, bool do_delete) {
       if (particles.empty()) return;
-      auto keptParticlesEnd = std::remove_if(particles.begin(), particles.end(),
-                                             [&](const HEPUtils::Particle* p) {
-                                               const bool rm = !random_bool(eff_pt, p->pT());
-                                               if (do_delete && rm) delete p;
-                                               return rm;
-                                             } );
-      particles.erase(keptParticlesEnd, particles.end());
+      std::vector<double> pt(particles.size()), effs;
+      for (size_t i = 0; i < particles.size(); ++i) pt[i] = particles[i]->pT();
+      binned_values(eff_pt, pt, effs);
+      filtereff(particles, effs, do_delete);
     }
 
 
     // Utility function for filtering a supplied particle vector by sampling wrt a binned 2D efficiency map in |eta| and pT
     void filtereff_etapt(std::vector<HEPUtils::Particle*>& particles, const HEPUtils::BinnedFn2D<double>& eff_etapt, bool do_delete) {
       if (particles.empty()) return;
-      auto keptParticlesEnd = std::remove_if(particles.begin(), particles.end(),
-                                             [&](const HEPUtils::Particle* p) {
-                                               const bool rm = !random_bool(eff_etapt, p->abseta(), p->pT());
-                                               if (do_delete && rm) delete p;
-                                               return rm;
-                                             } );
-      particles.erase(keptParticlesEnd, particles.end());
+      std::vector<double> effs;
+      binned_values_etapt(eff_etapt, particles, effs);
+      filtereff(particles, effs, do_delete);
     }
 
 
@@ -117,25 +117,17 @@ namespace Gambit {
         const P4 pmiss = event->missingmom();
         const double met = event->met();
         
-        // Get baseline jets
-        /// @todo Drop b-tag if pT < 50 GeV or |eta| > 2.5?
-        vector<const Jet*> baselineJets;
-        for (const Jet* jet : event->jets())
-          if (jet->pT() > 20. && jet->abseta() < 2.8) {
-            baselineJets.push_back(jet);
-          }
-
-        // Get baseline electrons
-        vector<const Particle*> baselineElectrons;
-        for (const Particle* electron : event->electrons())
-          if (electron->pT() > 7. && electron->abseta() < 2.47)
-            baselineElectrons.push_back(electron);
+        // Columnar view of the event's objects, shared with other analyses
+        const EventColumns& cols = columns(event);
+        const JetColumns& jets = cols.jets();
+        const ParticleColumns& electrons = cols.electrons();
+        const ParticleColumns& muons = cols.muons();
 
-        // Get baseline muons
-        vector<const Particle*> baselineMuons;
-        for (const Particle* muon : event->muons())
-          if (muon->pT() > 7. && muon->abseta() < 2.7)
-            baselineMuons.push_back(muon);
+        // Get baseline jets, electrons and muons, reusing them if another analysis already made them
+        /// @todo Drop b-tag if pT < 50 GeV or |eta| > 2.5?
+        const Selection& baselineJets = cols.selection("jets pT>20 |eta|<2.8", [&]{ return select(jets, 20., 2.8); });
+        const Selection& baselineElectrons = cols.selection("electrons pT>7 |eta|<2.47", [&]{ return select(electrons, 7., 2.47); });
+        const Selection& baselineMuons = cols.selection("muons pT>7 |eta|<2.7", [&]{ return select(muons, 7., 2.7); });
 
         // Full isolation details:
         //  - Remove electrons within dR = 0.2 of a b-tagged jet
@@ -148,32 +140,24 @@ namespace Gambit {
 
         // Remove any |eta| < 2.8 jet within dR = 0.2 of an electron
         /// @todo Unless b-tagged (and pT > 50 && abseta < 2.5)
-        vector<const Jet*> signalJets;
-        for (const Jet* j : baselineJets)
-          if (all_of(baselineElectrons, [&](const Particle* e){ return deltaR_rap(*e, *j) > 0.2; }))
-            signalJets.push_back(j);
+        const Selection& signalJetIdx = cols.selection("jets pT>20 |eta|<2.8, electron(pT>7 |eta|<2.47) overlap dR_rap>0.2",
+          [&]{ return isolated(jets, baselineJets, electrons, baselineElectrons, 0.2); });
+        const vector<const Jet*> signalJets = jets.get(signalJetIdx);
 
         // Remove electrons with dR = 0.4 of surviving |eta| < 2.8 jets
         /// @todo Actually only within 0.2--0.4...
-        vector<const Particle*> signalElectrons;
-        for (const Particle* e : baselineElectrons)
-          if (all_of(signalJets, [&](const Jet* j){ return deltaR_rap(*e, *j) > 0.4; }))
-            signalElectrons.push_back(e);
+        vector<const Particle*> signalElectrons = electrons.get(isolated(electrons, baselineElectrons, jets, signalJetIdx, 0.4));
         // Apply electron ID selection
         ATLAS::applyLooseIDElectronSelectionR2(signalElectrons);
 
         // Remove muons with dR = 0.4 of surviving |eta| < 2.8 jets
         /// @todo Actually only within 0.2--0.4...
         /// @note Within 0.2, discard the *jet* based on jet track vs. muon criteria... can't be done here
-        vector<const Particle*> signalMuons;
-        for (const Particle* m : baselineMuons)
-          if (all_of(signalJets, [&](const Jet* j){ return deltaR_rap(*m, *j) > 0.4; }))
-            signalMuons.push_back(m);
+        const vector<const Particle*> signalMuons = muons.get(isolated(muons, baselineMuons, jets, signalJetIdx, 0.4));
 
         // The subset of jets with pT > 50 GeV is used for several calculations
-        vector<const Jet*> signalJets50;
-        for (const Jet* j : signalJets)
-          if (j->pT() > 50) signalJets50.push_back(j);
+        const Selection signalJet50Idx = select(jets, signalJetIdx, 50., DBL_MAX);
+        const vector<const Jet*> signalJets50 = jets.get(signalJet50Idx);
 
 
         ////////////////////////////////
@@ -186,25 +170,15 @@ namespace Gambit {
         const size_t nJets = signalJets.size();
 
         // HT-related quantities (calculated over all >20 GeV jets)
-        double sumptj = 0;
-        for (const Jet* j : signalJets) sumptj += j->pT();
-        const double HT = sumptj;
+        const double HT = sum_pT(jets, signalJetIdx);
         const double sqrtHT = sqrt(HT);
         const double met_sqrtHT = met/sqrtHT;
 
         // Meff-related quantities (calculated over >50 GeV jets only)
-        double sumptj50_4 = 0, sumptj50_5 = 0, sumptj50_6 = 0, sumptj50_incl = 0;
-        for (size_t i = 0; i < signalJets50.size(); ++i) {
-          const Jet* j = signalJets50[i];
-          if (i < 4) sumptj50_4 += j->pT();
-          if (i < 5) sumptj50_5 += j->pT();
-          if (i < 6) sumptj50_6 += j->pT();
-          sumptj50_incl += j->pT();
-        }
-        const double meff_4 = met + sumptj50_4;
-        const double meff_5 = met + sumptj50_5;
-        const double meff_6 = met + sumptj50_6;
-        const double meff_incl = met + sumptj50_incl;
+        const double meff_4 = meff(cols, jets, signalJet50Idx, 4);
+        const double meff_5 = meff(cols, jets, signalJet50Idx, 5);
+        const double meff_6 = meff(cols, jets, signalJet50Idx, 6);
+        const double meff_incl = meff(cols, jets, signalJet50Idx);
         const double met_meff_4 = met / meff_4;
         const double met_meff_5 = met / meff_5;
         const double met_meff_6 = met / meff_6;
@@ -127,7 +127,8 @@ namespace Gambit
       ready(false),
       is_registered(false),
       n_threads(omp_get_max_threads()),
-      base_key("")
+      base_key(""),
+      event_columns(new EventColumns)
     {
       #ifdef ANALYSISCONTAINER_DEBUG
         std::cout << "DEBUG: thread " << omp_get_thread_num() << ": HEPUtilsAnalysisContainer::ctor: created at " << this << std::endl;
@@ -318,16 +319,21 @@ namespace Gambit
     /// Pass event through specific analysis
     void HEPUtilsAnalysisContainer::analyze(const HEPUtils::Event& event, string collider_name, string analysis_name) const
     {
-      analyses_map.at(collider_name).at(analysis_name)->do_analysis(event);
+      event_columns->bind(event);
+      analyses_map.at(collider_name).at(analysis_name)->do_analysis(&event, event_columns.get());
+      event_columns->unbind();
     }
 
     /// Pass event through all analysis for a specific collider
     void HEPUtilsAnalysisContainer::analyze(const HEPUtils::Event& event, string collider_name) const
     {
+      // The columns are filled at most once, by the first analysis that asks for them
+      event_columns->bind(event);
       for (auto& analysis_pointer_pair : analyses_map.at(collider_name))
       {
-        analysis_pointer_pair.second->do_analysis(event);
+        analysis_pointer_pair.second->do_analysis(&event, event_columns.get());
       }
+      event_columns->unbind();
     }
 
     /// Pass event through all analysis for the current collider
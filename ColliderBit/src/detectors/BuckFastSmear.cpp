@@ -26,8 +26,8 @@ namespace Gambit {
   namespace ColliderBit {
 
 
-    /// BuckFastIdentity definition
-    void BuckFastIdentity::processEvent(const Pythia8::Event& eventIn, HEPUtils::Event& eventOut) const {
+    /// Convert with the parton- or particle-level converter, as configured
+    void BuckFastBase::convertPythia8Event(const Pythia8::Event& eventIn, HEPUtils::Event& eventOut) const {
       if (partonOnly)
         convertPythia8PartonEvent(eventIn, eventOut);
       else
@@ -35,13 +35,46 @@ namespace Gambit {
     }
 
 
-    /// BuckFastSmearATLAS definitions
-    void BuckFastSmearATLAS::processEvent(const Pythia8::Event& eventIn, HEPUtils::Event& eventOut) const {
-      if (partonOnly)
-        convertPythia8PartonEvent(eventIn, eventOut);
-      else
-        convertPythia8ParticleEvent(eventIn, eventOut);
+    /// Convert and smear an event
+    void BuckFastBase::processEvent(const Pythia8::Event& eventIn, HEPUtils::Event& eventOut) const {
+      convertPythia8Event(eventIn, eventOut);
+      smearEvent(eventOut);
+    }
+
+
+    /// Smear a copy of the shared conversion of an event
+    void BuckFastBase::processEvent(const Pythia8::Event& eventIn, HEPUtils::Event& eventOut, TruthEventCache& cache) const {
+      const HEPUtils::Event& truth = cache.get(*this, eventIn);
+      eventOut.clear();
+      truth.cloneTo(eventOut);
+      smearEvent(eventOut);
+    }
 
+
+    /// Get (or make) the conversion of an event for the given detector's converter settings
+    const HEPUtils::Event& TruthEventCache::get(const BuckFastBase& det, const Pythia8::Event& pevt) {
+      Entry* slot = nullptr;
+      for (Entry& entry : _entries) {
+        if (entry.partonOnly == det.partonOnly and entry.antiktR == det.antiktR) {
+          if (entry.source == &pevt) return *entry.event;
+          slot = &entry;
+          break;
+        }
+      }
+      if (slot == nullptr) {
+        _entries.push_back(Entry{det.partonOnly, det.antiktR, nullptr, std::make_shared<HEPUtils::Event>()});
+        slot = &_entries.back();
+      }
+      // Invalidate first, in case the converter throws
+      slot->source = nullptr;
+      det.convertPythia8Event(pevt, *slot->event);
+      slot->source = &pevt;
+      return *slot->event;
+    }
+
+
+    /// BuckFastSmearATLAS definitions
+    void BuckFastSmearATLAS::smearEvent(HEPUtils::Event& eventOut) const {
       // Electron smearing and efficiency
       /// @todo Run-dependence?
       //ATLAS::applyElectronTrackingEff(eventOut.electrons());
@@ -70,12 +103,7 @@ namespace Gambit {
 
 
     /// BuckFastSmearATLASnoeff definitions
-    void BuckFastSmearATLASnoeff::processEvent(const Pythia8::Event& eventIn, HEPUtils::Event& eventOut) const {
-      if (partonOnly)
-        convertPythia8PartonEvent(eventIn, eventOut);
-      else
-        convertPythia8ParticleEvent(eventIn, eventOut);
-
+    void BuckFastSmearATLASnoeff::smearEvent(HEPUtils::Event& eventOut) const {
       // Electron smearing
       /// @todo Run-dependence?
       //ATLAS::applyElectronTrackingEff(eventOut.electrons());
@@ -101,12 +129,7 @@ namespace Gambit {
 
 
     /// BuckFastSmearCMS definition
-    void BuckFastSmearCMS::processEvent(const Pythia8::Event& eventIn, HEPUtils::Event& eventOut) const {
-      if (partonOnly)
-        convertPythia8PartonEvent(eventIn, eventOut);
-      else
-        convertPythia8ParticleEvent(eventIn, eventOut);
-
+    void BuckFastSmearCMS::smearEvent(HEPUtils::Event& eventOut) const {
       //MJW debug- make this the same as ATLAS temporarily
       // Electron smearing and efficiency
       //CMS::applyElectronTrackingEff(eventOut.electrons());
@@ -134,12 +157,7 @@ namespace Gambit {
 
 
     /// BuckFastSmearCMSnoeff definition
-    void BuckFastSmearCMSnoeff::processEvent(const Pythia8::Event& eventIn, HEPUtils::Event& eventOut) const {
-      if (partonOnly)
-        convertPythia8PartonEvent(eventIn, eventOut);
-      else
-        convertPythia8ParticleEvent(eventIn, eventOut);
-
+    void BuckFastSmearCMSnoeff::smearEvent(HEPUtils::Event& eventOut) const {
       //MJW debug- make this the same as ATLAS temporarily
       // Electron smearing
       //CMS::applyElectronTrackingEff(eventOut.electrons());
@@ -226,6 +244,9 @@ namespace Gambit {
         }
       }
 
+      // Hadron ancestry of every particle, for the promptness test below
+      const Py8Ancestry ancestry(pevt);
+
       // Loop over final state particles for jet inputs and MET
       std::vector<FJNS::PseudoJet> jetparticles;
       for (int i = 0; i < pevt.size(); ++i) {
@@ -254,7 +275,7 @@ namespace Gambit {
         }
 
         // Promptness: for leptons and photons we're only interested if they don't come from hadron/tau decays
-        const bool prompt = !fromHadron(i, pevt); //&& !fromTau(i, pevt);
+        const bool prompt = !ancestry.fromHadron(i); //&& !ancestry.fromTau(i);
         const bool visible = MCUtils::PID::isStrongInteracting(p.id()) || MCUtils::PID::isEMInteracting(p.id());
 
         // Add prompt and invisible particles as individual particles
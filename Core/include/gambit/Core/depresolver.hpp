@@ -133,6 +133,9 @@ namespace Gambit
         /// Getter for print_timing flag (used by LikelihoodContainer)
         bool printTiming();
 
+        /// Wall-clock time in seconds taken by the last call to doResolution
+        double resolutionTime();
+
         /// Get the functor corresponding to a single VertexID
         functor* get_functor(VertexID);
 
@@ -166,6 +169,15 @@ namespace Gambit
         /// Adds list of functor pointers to master graph
         void addFunctors();
 
+        /// Index module, model and backend functors by capability
+        void buildCapabilityIndex();
+
+        /// Vertices in masterGraph that could provide a given capability, in vertex order
+        std::vector<VertexID> verticesWithCapability(const str&);
+
+        /// Backend functors providing any of the capabilities in a set of requirements, in registration order
+        std::vector<functor*> backendFunctorsWithCapabilities(const std::set<sspair>&);
+
         /// Pretty print backend functor information
         str printGenericFunctorList(const std::vector<functor*>&);
         str printGenericFunctorList(const std::vector<VertexID>&);
@@ -267,6 +279,18 @@ namespace Gambit
         /// Global flag for triggering printing of timing data
         bool print_timing = false;
 
+        /// Vertices in masterGraph indexed by capability
+        std::map<str, std::vector<VertexID>> capabilityIndex;
+
+        /// Vertices whose capability is a wildcard or pattern, and so must always be considered
+        std::vector<VertexID> unindexedVertices;
+
+        /// Positions of backend functors in the core's list, indexed by capability
+        std::map<str, std::vector<size_t>> backendCapabilityIndex;
+
+        /// Time taken by dependency resolution (seconds)
+        double resolution_time = 0;
+
   };
   }
 }
@@ -58,6 +58,17 @@ namespace Gambit
       /// Map of scanned model names to primary model functors
       std::map<str, primary_model_functor *> functorMap;
 
+      /// Position of a model parameter in the flat parameter array, and where its value lives in the primary_model_parameters functor
+      struct parameter_slot
+      {
+        str name;
+        int index;
+        double *value;
+      };
+
+      /// Index-resolved parameter layout (one entry per scanned model, in the order of functorMap), fixed by setParameterLayout
+      std::vector<std::pair<str, std::vector<parameter_slot>>> parameterLayout;
+
       /// MPI communicator group for errors
       #ifdef WITH_MPI
         GMPI::Comm& errorComm;
@@ -93,6 +104,12 @@ namespace Gambit
       /// Run in likelihood debug mode?
       bool debug;
 
+      /// Report the values of the parameters for a new point to the exception system and the logs
+      void announceParameters (const str &);
+
+      /// Evaluate total likelihood function, with parameters from either the map or the flat array
+      double evaluate (const std::unordered_map<std::string, double> *, const double *);
+
     public:
 
       /// Constructor
@@ -107,9 +124,18 @@ namespace Gambit
       /// Do the prior transformation and populate the parameter map
       void setParameters (const std::unordered_map<std::string, double> &);
 
+      /// Populate the parameter map from a flat parameter array laid out by setParameterLayout
+      void setParameters (const double *);
+
+      /// Fix the positions of all model parameters in the flat parameter array
+      bool setParameterLayout (const std::vector<std::string> &);
+
       /// Evaluate total likelihood function
       double main (std::unordered_map<std::string, double> &in);
 
+      /// Evaluate total likelihood function, taking the parameters as a flat array laid out by setParameterLayout
+      double main_indexed (const double *in);
+
   };
 
   // Register the Likelihood Container as an available target function for ScannerBit.  The first argument
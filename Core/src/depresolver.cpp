@@ -42,6 +42,9 @@
 #include <sstream>
 #include <fstream>
 #include <iomanip>
+#include <tuple>
+#include <chrono>
+#include <algorithm>
 #ifdef HAVE_REGEX_H
   #include <regex>
 #endif
@@ -247,6 +250,23 @@ namespace Gambit
       return result;
     }
 
+    // Check whether a string contains no regex metacharacters, i.e. can only match itself
+    bool isLiteral(const str & s)
+    {
+      return s.find_first_of(".^$|()[]{}*+?\\") == str::npos;
+    }
+
+#ifdef HAVE_REGEX_H
+    // Return a compiled regex for the given pattern, compiling it only the first time it is seen
+    const std::regex & compiledRegex(const str & pattern)
+    {
+      static std::map<str, std::regex> cache;
+      auto it = cache.find(pattern);
+      if (it == cache.end()) it = cache.emplace(pattern, std::regex(pattern)).first;
+      return it->second;
+    }
+#endif
+
     // Check whether s1 (wildcard + regex allowed) matches s2
     bool stringComp(const str & s1, const str & s2, bool with_regex)
     {
@@ -254,9 +274,11 @@ namespace Gambit
       if ( s1 == "" ) return true;
       if ( s1 == "*" ) return true;
 #ifdef HAVE_REGEX_H
+      // A pattern without metacharacters only matches itself, which was tested above.
+      if ( not with_regex or isLiteral(s1) ) return false;
       try
       {
-        if (with_regex) if (std::regex_match(s2, std::regex(s1))) return true;
+        if (std::regex_match(s2, compiledRegex(s1))) return true;
       }
       catch (std::regex_error & err)
       {
@@ -271,7 +293,7 @@ namespace Gambit
     }
 
     // Same thing for types (taking into account equivalence classes)
-    bool typeComp(str s1, str s2, const Utils::type_equivalency & eq, bool with_regex)
+    bool typeComp_uncached(str s1, str s2, const Utils::type_equivalency & eq, bool with_regex)
     {
       bool match1, match2;
       // Loop over all the default versions of BOSSed backends and strip off any corresponding leading namespace.
@@ -296,6 +318,19 @@ namespace Gambit
       return false;
     }
 
+    // Memoised version of the above; the same handful of type pairs are compared over and over during resolution.
+    bool typeComp(str s1, str s2, const Utils::type_equivalency & eq, bool with_regex)
+    {
+      typedef std::tuple<const Utils::type_equivalency*, str, str, bool> key_type;
+      static std::map<key_type, bool> cache;
+      key_type key(&eq, s1, s2, with_regex);
+      auto it = cache.find(key);
+      if (it != cache.end()) return it->second;
+      bool result = typeComp_uncached(s1, s2, eq, with_regex);
+      cache.emplace(std::move(key), result);
+      return result;
+    }
+
 
     ///////////////////////////////////////////////////
     // Public definitions of DependencyResolver class
@@ -316,6 +351,7 @@ namespace Gambit
        activeFunctorGraphFile(GAMBIT_DIR "/scratch/GAMBIT_active_functor_graph.gv")
     {
       addFunctors();
+      buildCapabilityIndex();
       logger() << LogTags::dependency_resolver << endl;
       logger() << "#######################################"   << endl;
       logger() << "#  List of Type Equivalency Classes   #"   << endl;
@@ -335,6 +371,7 @@ namespace Gambit
     // Main dependency resolution
     void DependencyResolver::doResolution()
     {
+      std::chrono::time_point<std::chrono::system_clock> startT = std::chrono::system_clock::now();
       const IniParser::ObservablesType & observables = boundIniFile->getObservables();
       // (cap., typ) --> dep. vertex map
       std::queue<QueueEntry> parQueue;
@@ -405,6 +442,11 @@ namespace Gambit
         SortedParentVertices[*it] = getSortedParentVertices(*it, masterGraph, function_order);
       }
 
+      // Record how long all of this took
+      std::chrono::duration<double> interval = std::chrono::system_clock::now() - startT;
+      resolution_time = interval.count();
+      logger() << LogTags::dependency_resolver << LogTags::info << "Dependency resolution took " << resolution_time << " seconds." << EOM;
+
       // Done
     }
 
@@ -666,6 +708,9 @@ namespace Gambit
     /// Getter for print_timing flag (used by LikelihoodContainer)
     bool DependencyResolver::printTiming() { return print_timing; }
 
+    /// Wall-clock time in seconds taken by the last call to doResolution
+    double DependencyResolver::resolutionTime() { return resolution_time; }
+
     // Get the functor corresponding to a single VertexID
     functor* DependencyResolver::get_functor(VertexID id)
     {
@@ -809,6 +854,59 @@ namespace Gambit
       }
     }
 
+    // Index vertices and backend functors by capability, so that resolution does not need to scan them all
+    void DependencyResolver::buildCapabilityIndex()
+    {
+      graph_traits<DRes::MasterGraphType>::vertex_iterator vi, vi_end;
+      capabilityIndex.clear();
+      unindexedVertices.clear();
+      backendCapabilityIndex.clear();
+      for (boost::tie(vi, vi_end) = vertices(masterGraph); vi != vi_end; ++vi)
+      {
+        const str & capability = masterGraph[*vi]->capability();
+        // Capabilities are matched as patterns against the requested quantity, so only literal ones can be indexed.
+        if (capability != "" and isLiteral(capability))
+          capabilityIndex[capability].push_back(*vi);
+        else
+          unindexedVertices.push_back(*vi);
+      }
+      const std::vector<functor*> & backendFunctors = boundCore->getBackendFunctors();
+      for (size_t i = 0; i < backendFunctors.size(); ++i)
+      {
+        backendCapabilityIndex[backendFunctors[i]->capability()].push_back(i);
+      }
+    }
+
+    // Vertices that could provide a given capability, in the same order as a full scan of masterGraph
+    std::vector<DRes::VertexID> DependencyResolver::verticesWithCapability(const str & capability)
+    {
+      std::vector<VertexID> result(unindexedVertices);
+      auto it = capabilityIndex.find(capability);
+      if (it != capabilityIndex.end()) result.insert(result.end(), it->second.begin(), it->second.end());
+      if (not unindexedVertices.empty()) std::sort(result.begin(), result.end());
+      return result;
+    }
+
+    // Backend functors providing any of the required capabilities, in the order they were registered with the core
+    std::vector<functor*> DependencyResolver::backendFunctorsWithCapabilities(const std::set<sspair> & reqs)
+    {
+      std::vector<size_t> positions;
+      for (auto itr = reqs.begin(); itr != reqs.end(); ++itr)
+      {
+        auto it = backendCapabilityIndex.find(itr->first);
+        if (it != backendCapabilityIndex.end()) positions.insert(positions.end(), it->second.begin(), it->second.end());
+      }
+      std::sort(positions.begin(), positions.end());
+      positions.erase(std::unique(positions.begin(), positions.end()), positions.end());
+      std::vector<functor*> result;
+      result.reserve(positions.size());
+      for (auto it = positions.begin(); it != positions.end(); ++it)
+      {
+        result.push_back(boundCore->getBackendFunctors()[*it]);
+      }
+      return result;
+    }
+
     /// Activate functors that are allowed to be used with one or more of the models being scanned.
     /// Also activate the model-conditional dependencies and backend requirements of those functors.
     void DependencyResolver::makeFunctorsModelCompatible()
@@ -995,7 +1093,9 @@ namespace Gambit
     DRes::VertexID DependencyResolver::resolveDependencyFromRules(
         const DRes::VertexID & toVertex, const sspair & quantity)
     {
-      graph_traits<DRes::MasterGraphType>::vertex_iterator vi, vi_end;
+      // Vertices that can possibly provide the requested capability
+      const std::vector<DRes::VertexID> capabilityCandidates = verticesWithCapability(quantity.first);
+      std::vector<DRes::VertexID>::const_iterator vi, vi_end = capabilityCandidates.end();
 
       // List of candidate vertices
       std::vector<DRes::VertexID> vertexCandidates;  // enabled
@@ -1008,7 +1108,7 @@ namespace Gambit
       std::vector<DRes::VertexID> filteredVertexCandidates2;
 
       // Make list of candidate vertices.
-      for (tie(vi, vi_end) = vertices(masterGraph); vi != vi_end; ++vi)
+      for (vi = capabilityCandidates.begin(); vi != vi_end; ++vi)
       {
         // Match capabilities and types (no type comparison when no types are
         // given; this can only apply to output nodes).
@@ -1253,7 +1353,8 @@ namespace Gambit
     boost::tuple<const IniParser::ObservableType *, DRes::VertexID>
         DependencyResolver::resolveDependency( DRes::VertexID toVertex, sspair quantity)
     {
-      graph_traits<DRes::MasterGraphType>::vertex_iterator vi, vi_end;
+      const std::vector<DRes::VertexID> capabilityCandidates = verticesWithCapability(quantity.first);
+      std::vector<DRes::VertexID>::const_iterator vi, vi_end = capabilityCandidates.end();
       const IniParser::ObservableType *auxEntry = NULL;  // Ptr. on ini-file entry of the dependent vertex (if existent)
       const IniParser::ObservableType *depEntry = NULL;  // Ptr. on ini-file entry that specifies how to resolve 'quantity'
       std::vector<DRes::VertexID> vertexCandidates;
@@ -1283,9 +1384,9 @@ namespace Gambit
         }
       }
 
-      // Loop over all available vertices in masterGraph, and make a list of
-      // functors that fulfill the dependency requirement.
-      for (tie(vi, vi_end) = vertices(masterGraph); vi != vi_end; ++vi)
+      // Loop over all vertices in masterGraph that might provide the capability,
+      // and make a list of functors that fulfill the dependency requirement.
+      for (vi = capabilityCandidates.begin(); vi != vi_end; ++vi)
       {
         // Don't allow resolution by deactivated functors
         if (masterGraph[*vi]->status() > 0)
@@ -1602,6 +1703,19 @@ namespace Gambit
               Options myOptions = collectIniOptions(fromVertex);
               masterGraph[fromVertex]->notifyOfIniOptions(myOptions);
             }
+            // Switch on memoisation of results if requested via the 'memoise' option
+            int memoise = masterGraph[fromVertex]->getOptions()->getValueOrDef<int>(0, "memoise");
+            if (memoise > 0)
+            {
+              logger() << LogTags::dependency_resolver << "Memoising up to " << memoise << " results" << endl;
+              masterGraph[fromVertex]->setMemoisation(memoise);
+            }
+            // Declare the result fully determined by the dependencies if requested via the 'pure' option
+            if (masterGraph[fromVertex]->getOptions()->getValueOrDef<bool>(false, "pure"))
+            {
+              logger() << LogTags::dependency_resolver << "Declared pure" << endl;
+              masterGraph[fromVertex]->setPure(true);
+            }
           }
           // Fill parameter queue with dependencies of fromVertex
           fillParQueue(&parQueue, fromVertex);
@@ -1811,11 +1925,12 @@ namespace Gambit
       std::vector<functor*> vertexCandidatesWithIniEntry;
       std::vector<functor*> disabledVertexCandidates;
 
-      // Loop over all existing backend vertices, and make a list of
-      // functors that are available and fulfill the backend requirement
+      // Loop over all backend vertices with a required capability, and make a
+      // list of functors that are available and fulfill the backend requirement
+      const std::vector<functor*> capabilityCandidates = backendFunctorsWithCapabilities(reqs);
       for (std::vector<functor *>::const_iterator
-          itf  = boundCore->getBackendFunctors().begin();
-          itf != boundCore->getBackendFunctors().end();
+          itf  = capabilityCandidates.begin();
+          itf != capabilityCandidates.end();
           ++itf)
       {
         const IniParser::ObservableType * reqEntry = NULL;
@@ -153,7 +153,7 @@ int main(int argc, char* argv[])
       // Do the dependency resolution
       if (rank == 0) cout << "Resolving dependencies and backend requirements.  Hang tight..." << endl;
       dependencyResolver.doResolution();
-      if (rank == 0) cout << "...done!" << endl;
+      if (rank == 0) cout << "...done! (" << dependencyResolver.resolutionTime() << " s)" << endl;
 
       // Check that all requested models are used for at least one computation
       Models::ModelDB().checkPrimaryModelFunctorUsage(Core().getActiveModelFunctors());
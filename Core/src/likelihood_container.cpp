@@ -122,8 +122,63 @@ namespace Gambit
       }
     }
 
+    announceParameters(parstream.str());
+  }
+
+  /// Populate the parameter map from a flat parameter array laid out by setParameterLayout
+  void Likelihood_Container::setParameters (const double *parameters)
+  {
+    // Set up a stream containing the parameter values, for diagnostic output
+    std::ostringstream parstream;
+
+    // Iterate over the primary_model_parameters functors of all the models being scanned, in the same order as the map version.
+    for (auto act_it = parameterLayout.begin(), act_end = parameterLayout.end(); act_it != act_end; act_it++)
+    {
+      parstream << "  " << act_it->first << ":" << endl;
+      for (auto par_it = act_it->second.begin(), par_end = act_it->second.end(); par_it != par_end; par_it++)
+      {
+        double value = parameters[par_it->index];
+        parstream << "    " << par_it->name << ": " << value << endl;
+        *(par_it->value) = value;
+      }
+    }
+
+    announceParameters(parstream.str());
+  }
+
+  /// Fix the positions of all model parameters in the flat parameter array
+  bool Likelihood_Container::setParameterLayout (const std::vector<std::string> &names)
+  {
+    std::unordered_map<str, int> positions;
+    for (int i = 0, end = names.size(); i < end; i++) positions[names[i]] = i;
+
+    parameterLayout.clear();
+    for (auto act_it = functorMap.begin(), act_end = functorMap.end(); act_it != act_end; act_it++)
+    {
+      ModelParameters *contents = act_it->second->getcontentsPtr();
+      std::vector<parameter_slot> slots;
+      auto paramkeys = contents->getKeys();
+      for (auto par_it = paramkeys.begin(), par_end = paramkeys.end(); par_it != par_end; par_it++)
+      {
+        auto pos = positions.find(act_it->first + "::" + *par_it);
+        // Leave missing parameters to the map version, which knows how to report them.
+        if (pos == positions.end())
+        {
+          parameterLayout.clear();
+          return false;
+        }
+        slots.push_back({*par_it, pos->second, contents->getValuePtr(*par_it)});
+      }
+      parameterLayout.push_back(std::make_pair(act_it->first, std::move(slots)));
+    }
+    return true;
+  }
+
+  /// Report the values of the parameters for a new point to the exception system and the logs
+  void Likelihood_Container::announceParameters (const str &parameters)
+  {
     // Notify all exceptions of the values of the parameters for this point.
-    exception::set_parameters("\n\nYAML-ready parameter values at failed point:\n"+parstream.str());
+    exception::set_parameters("\n\nYAML-ready parameter values at failed point:\n"+parameters);
 
     // Print out the MPI rank and values of the parameters for this point if in debug mode.
     if (debug)
@@ -132,17 +187,29 @@ namespace Gambit
         GMPI::Comm COMM_WORLD;
         std::cout << "MPI process rank: "<< COMM_WORLD.Get_rank() << std::endl;
       #endif
-      cout << parstream.str();
-      // logger() << LogTags::core << "\nBeginning computations for parameter point:\n" << parstream.str() << EOM;
+      cout << parameters;
+      // logger() << LogTags::core << "\nBeginning computations for parameter point:\n" << parameters << EOM;
     }
     // Print the parameter point to the logs, even if not in debug mode
-    logger() << LogTags::core << "\nBeginning computations for parameter point:\n" << parstream.str() << EOM;
+    logger() << LogTags::core << "\nBeginning computations for parameter point:\n" << parameters << EOM;
 
 
   }
 
   /// Evaluate total likelihood function
   double Likelihood_Container::main(std::unordered_map<std::string, double> &in)
+  {
+    return evaluate(&in, NULL);
+  }
+
+  /// Evaluate total likelihood function, taking the parameters as a flat array laid out by setParameterLayout
+  double Likelihood_Container::main_indexed(const double *in)
+  {
+    return evaluate(NULL, in);
+  }
+
+  /// Evaluate total likelihood function, with parameters from either the map or the flat array
+  double Likelihood_Container::evaluate(const std::unordered_map<std::string, double> *map_in, const double *flat_in)
   {
     logger() << LogTags::core << LogTags::debug << "Entered Likelihood_Container::main" << EOM;
 
@@ -185,7 +252,7 @@ namespace Gambit
       bool compute_aux = true;
 
       // Set the values of the parameter point in the PrimaryParameters functor, and log them to cout and/or the logs if desired.
-      setParameters(in);
+      if (flat_in) setParameters(flat_in); else setParameters(*map_in);
 
       // Logger debug output; things labelled 'LogTags::debug' only get logged if the logger::debug or master debug flags are true, not if only 'likelihood::debug' is true.
       logger() << LogTags::core << LogTags::debug << "Number of target vertices to calculate:    " << target_vertices.size() << endl
@@ -151,26 +151,33 @@ namespace Gambit
 
     /// \brief Channel container
     /// Object containing tabularized yields for particle decay and two-body final states.
+    /// Channels are hash-indexed by their (unordered) initial states and final state as
+    /// they are added, so lookups do not depend on the size of the table.
     class SimYieldTable
     {
         public:
             SimYieldTable();
-            void addChannel(daFunk::Funk dNdE, std::string p1, std::string p2, std::string finalState, double Ecm_min, double Ecm_max);
-            void addChannel(daFunk::Funk dNdE, std::string p1, std::string finalState, double Ecm_min, double Ecm_max);
-            bool hasChannel(std::string p1, std::string p2, std::string finalState) const;
-            bool hasChannel(std::string p1, std::string finalState) const;
-            bool hasAnyChannel(std::string p1) const;
-            bool hasAnyChannel(std::string p1, std::string p2) const;
-            const SimYieldChannel& getChannel(std::string p1, std::string p2, std::string finalState) const;
-            daFunk::Funk operator()(std::string p1, std::string p2, std::string finalState, double Ecm) const;
-            daFunk::Funk operator()(std::string p1, std::string finalState, double Ecm) const;
-            daFunk::Funk operator()(std::string p1, std::string p2, std::string finalState) const;
-            daFunk::Funk operator()(std::string p1, std::string finalState) const;
+            void addChannel(daFunk::Funk dNdE, const std::string& p1, const std::string& p2, const std::string& finalState, double Ecm_min, double Ecm_max);
+            void addChannel(daFunk::Funk dNdE, const std::string& p1, const std::string& finalState, double Ecm_min, double Ecm_max);
+            bool hasChannel(const std::string& p1, const std::string& p2, const std::string& finalState) const;
+            bool hasChannel(const std::string& p1, const std::string& finalState) const;
+            bool hasAnyChannel(const std::string& p1) const;
+            bool hasAnyChannel(const std::string& p1, const std::string& p2) const;
+            /// Channel for the given states; its dNdE_bound member is the yield pre-bound to (E, Ecm)
+            const SimYieldChannel& getChannel(const std::string& p1, const std::string& p2, const std::string& finalState) const;
+            daFunk::Funk operator()(const std::string& p1, const std::string& p2, const std::string& finalState, double Ecm) const;
+            daFunk::Funk operator()(const std::string& p1, const std::string& finalState, double Ecm) const;
+            daFunk::Funk operator()(const std::string& p1, const std::string& p2, const std::string& finalState) const;
+            daFunk::Funk operator()(const std::string& p1, const std::string& finalState) const;
 
         private:
             SimYieldChannel dummy_channel;
             std::vector<SimYieldChannel> channel_list;
-            int findChannel(std::string p1, std::string p2, std::string finalState) const;
+            /// Positions in channel_list keyed by (p1, p2, finalState), with p1 and p2 unordered
+            TH_ParticleIndex channel_index = TH_ParticleIndex(2);
+            /// Initial states (p1, p2), unordered, that have at least one channel
+            TH_ParticleIndex initial_state_index = TH_ParticleIndex(2);
+            int findChannel(const std::string& p1, const std::string& p2, const std::string& finalState) const;
     };
 
   }
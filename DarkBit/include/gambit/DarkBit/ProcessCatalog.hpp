@@ -29,6 +29,7 @@
 
 #include <vector>
 #include <map>
+#include <unordered_map>
 
 #include "gambit/Utils/util_types.hpp"
 #include "gambit/cmake/cmake_variables.hpp"
@@ -66,6 +67,56 @@ namespace Gambit
       std::vector<double> threshold_energy;
     };
 
+    /// \brief Hash index of list positions keyed by up to four particle names.
+    ///
+    /// Names are interned to small integer IDs as they are inserted, so a lookup
+    /// hashes each name once and never builds temporary strings; names that were
+    /// never inserted fail immediately.  The first nSymmetric names of a key are
+    /// treated as an unordered set (e.g. the two initial states of a channel, or
+    /// all final states), the remaining ones are matched in order.  If several
+    /// positions are inserted under the same key, the first one is kept, as for a
+    /// linear search.
+    class TH_ParticleIndex
+    {
+      public:
+        /// Maximum number of names per key
+        static const size_t maxNames = 4;
+
+        TH_ParticleIndex(unsigned int nSymmetric = 0) : nSymmetric(nSymmetric) {}
+
+        /// Record position pos under the key given by a list of names; keys of more than maxNames names are ignored
+        /// @{
+        void insert(const std::vector<str>& names, int pos);
+        void insert(const str& p1, const str& p2, int pos) { const str* n[] = {&p1, &p2}; insert(n, 2, pos); }
+        void insert(const str& p1, const str& p2, const str& p3, int pos) { const str* n[] = {&p1, &p2, &p3}; insert(n, 3, pos); }
+        /// @}
+
+        /// Position recorded under the key given by a list of names, or -1 if there is none
+        /// @{
+        int find(const std::vector<str>& names) const;
+        int find(const str& p1, const str& p2) const { const str* n[] = {&p1, &p2}; return find(n, 2); }
+        int find(const str& p1, const str& p2, const str& p3) const { const str* n[] = {&p1, &p2, &p3}; return find(n, 3); }
+        /// @}
+
+        /// Forget all keys and interned names
+        void clear() { ids.clear(); positions.clear(); }
+
+        /// Number of keys in the index
+        size_t size() const { return positions.size(); }
+
+      private:
+        /// Marker for unused slots in a key
+        static const unsigned int noName = 0xFFFF;
+        void insert(const str* const* names, size_t n, int pos);
+        int find(const str* const* names, size_t n) const;
+        /// Pack the IDs of one key into a single integer
+        unsigned long long key(unsigned int* ids, size_t n) const;
+
+        unsigned int nSymmetric;
+        std::unordered_map<str, unsigned int> ids;
+        std::unordered_map<unsigned long long, int> positions;
+    };
+
     /// A container for the mass and spin of a particle.
     struct TH_ParticleProperty
     {
@@ -134,6 +185,9 @@ namespace Gambit
         /// Check for given channel.  Return a pointer to it if found, NULL if not.
         const TH_Channel* find(std::vector<str>) const;
 
+        /// Index channelList by final states, for find().  Called by TH_ProcessCatalog::validate().
+        void buildIndex();
+
 
         // Variables
 
@@ -157,6 +211,12 @@ namespace Gambit
 
         /// Additional decay rate or sigmav (in addition to above channels)
         daFunk::Funk genRateMisc;
+
+        /// Positions in channelList keyed by final states, and the list size when it was built
+        /// @{
+        TH_ParticleIndex channelIndex = TH_ParticleIndex(TH_ParticleIndex::maxNames);
+        size_t channelIndexSize = 0;
+        /// @}
     };
 
     /// A container holding all annihilation and decay initial states relevant for DarkBit.
@@ -176,9 +236,13 @@ namespace Gambit
         /// Check whether particle is in particle properties catalog
         bool hasParticleProperty(str) const;
 
-        /// Validate kinematics and entries
+        /// Validate kinematics and entries, and index the processes and channels for find()
         void validate();
 
+        /// Index processList by initial states, and each process by final states.
+        /// Called by validate(); call it again after adding processes or channels.
+        void buildIndex();
+
 
         // Variables
 
@@ -187,6 +251,13 @@ namespace Gambit
 
         /// Map from particles involved in the processes of this catalog, to their properties.
         std::map<std::string, TH_ParticleProperty> particleProperties;
+
+        /// Positions in processList keyed by initial states, and the list size when it was built.
+        /// find() falls back to a linear search if processList has changed size since.
+        /// @{
+        TH_ParticleIndex processIndex;
+        size_t processIndexSize = 0;
+        /// @}
     };
   }
 }
@@ -60,6 +60,13 @@ namespace Gambit
         /// Important: Input histogram MUST have identical binning for this to give correct results.
         void addHistAsWeights_sameBin(SimpleHist &in);
 
+        /// Add the bin contents and squared weights of an identically binned histogram,
+        /// as if its events had been filled into this one
+        void addHist(const SimpleHist &in);
+
+        /// Set all bin contents to zero, keeping the binning
+        void reset();
+
         /// Get error for a specified bin
         double getError(int bin) const;
 
@@ -88,8 +95,13 @@ namespace Gambit
 
         void getEdges(double& lower, double& upper) const;
 
+        /// Recompute binWidths from binLower
+        void setBinWidths();
+
         // Variables
         std::vector<double> binLower;
+        /// Width of each bin, cached from binLower when the histogram is constructed
+        std::vector<double> binWidths;
         std::vector<double> binVals;
         /// Sum of the squares of all weights
         std::vector<double> wtSq;
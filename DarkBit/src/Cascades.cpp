@@ -100,31 +100,35 @@ namespace Gambit
       for(std::vector<std::string>::const_iterator
           cit =chainList.begin(); cit != chainList.end(); cit++)
       {
-        int it;
         int counter = 0;
         bool finished = false;
         // Set next initial state
         Loop::executeIteration(MC_NEXT_STATE);
-        // Event generation loop
-        #pragma omp parallel private(it) shared(counter, finished)
+        // Event generation loop.  Event numbers are handed out with an atomic
+        // increment, so threads never queue for a lock between events.
+        #pragma omp parallel shared(counter, finished)
         {
-          while (!finished)
+          bool done = false;
+          while (!done)
           {
-            #pragma omp critical (cascadeMC_Counter)
-            {
-              counter++;
-              it = counter;
-            }
+            int it;
+            #pragma omp atomic capture
+            it = ++counter;
             Loop::executeIteration(it);
-            #pragma omp critical (cascadeMC_Counter)
+            int count;
+            #pragma omp atomic read
+            count = counter;
+            if((*Loop::done and ((count >= cMC_minEvents) or piped_errors.inquire()))
+              or (count >= cMC_maxEvents))
             {
-              if((*Loop::done and ((counter >= cMC_minEvents) or piped_errors.inquire()))
-                or (counter >= cMC_maxEvents))
-                  finished=true;
-              if (counter >= cMC_maxEvents)
-                DarkBit_warning().raise(LOCAL_INFO,
-                    "WARNING FCMC: cMC_maxEvents reached without convergence.");
+              #pragma omp atomic write
+              finished = true;
             }
+            if (it == cMC_maxEvents)
+              DarkBit_warning().raise(LOCAL_INFO,
+                  "WARNING FCMC: cMC_maxEvents reached without convergence.");
+            #pragma omp atomic read
+            done = finished;
           }
         }
         // Raise any exceptions
@@ -229,15 +233,15 @@ namespace Gambit
       chain=ChainContainer(chn);
     }
 
-    /** Function for sampling SimYieldTables (tabulated spectra).
+    /** Function for sampling SimYieldTables (tabulated spectra) into the
+      * histogram hist.
       * This is a convenience function used in cascadeMC_Histograms, and does
       * not have an associated capability.  */
     void cascadeMC_sampleSimYield( const SimYieldTable &table,
         const DarkBit::DecayChain::ChainParticle* endpoint,
         std::string finalState,
         const TH_ProcessCatalog &catalog,
-        std::map<std::string, std::map<std::string, SimpleHist> > &histList,
-        std::string initialState,
+        SimpleHist &hist,
         double weight, int cMC_numSpecSamples
         )
     {
@@ -288,7 +292,7 @@ namespace Gambit
       const double msq = m*m;
       // Get histogram edges
       double histEmin, histEmax;
-      histList[initialState][finalState].getEdges(histEmin, histEmax);
+      hist.getEdges(histEmin, histEmax);
 
       // Calculate energies to sample between.  A particle decaying
       // isotropically in its rest frame will give a box spectrum.  This is
@@ -315,7 +319,6 @@ namespace Gambit
         std::cout << "p_lab = " << endpoint->p_Lab() << std::endl;
         std::cout << "Lorentz factors gamma, beta: " << gamma << ", "
           << beta << std::endl;
-        std::cout << "Initial state: " << initialState << std::endl;
         std::cout << "Channel: " << p1 << " " << p2 << std::endl;
         std::cout << "Final particles: " << finalState << std::endl;
         std::cout << "Event weight: "    << weight << std::endl;
@@ -329,7 +332,7 @@ namespace Gambit
 
       double specSum=0;
       int Nsampl=0;
-      SimpleHist spectrum(histList[initialState][finalState].binLower);
+      SimpleHist spectrum(hist.binLower);
       while(Nsampl<cMC_numSpecSamples)
       {
         // Draw an energy in the CoM frame of the endpoint. Logarithmic
@@ -354,8 +357,32 @@ namespace Gambit
         spectrum.multiply(1.0/Nsampl);
         // Add bin contents of spectrum histogram to main histogram as weighted
         // events
-        #pragma omp critical (cascadeMC_histList)
-          histList[initialState][finalState].addHistAsWeights_sameBin(spectrum);
+        hist.addHistAsWeights_sameBin(spectrum);
+      }
+    }
+
+    /// Histograms filled by a single thread of the cascade MC, indexed by
+    /// integer (initial state, final state) IDs.
+    struct cascadeMC_HistBank
+    {
+      std::vector<std::vector<SimpleHist> > hists;
+      /// Number of events filled since this thread's histograms for the
+      /// current initial state were last merged into the shared list
+      int unmerged;
+      /// Last end-check period (global event number / cMC_endCheckFrequency)
+      /// for which this thread has merged its histograms
+      int mergedPeriod;
+    };
+
+    /// Add a thread's histograms for one initial state to the shared list and zero them
+    void cascadeMC_mergeHists(std::vector<SimpleHist> &hists,
+        std::map<std::string, SimpleHist> &shared,
+        const std::vector<std::string> &finalStates)
+    {
+      for(size_t f=0; f<finalStates.size(); f++)
+      {
+        shared[finalStates[f]].addHist(hists[f]);
+        hists[f].reset();
       }
     }
 
@@ -374,8 +401,19 @@ namespace Gambit
       static int    cMC_NhistBins;
       static double cMC_binLow;
       static double cMC_binHigh;
-      // Histogram list shared between all threads
+      // Histogram list shared between all threads.  Events are histogrammed
+      // into thread-private banks.  Each thread merges its bank into this list
+      // as soon as the global event number passes a multiple of
+      // cMC_endCheckFrequency (so that the end conditions can be checked), and
+      // all banks are merged once more at MC_FINALIZE.
       static std::map<std::string, std::map<std::string, SimpleHist> > histList;
+      // Number of events of the current initial state merged into histList
+      static int mergedEvents;
+      // Thread-private histogram banks, indexed by thread number
+      static std::vector<cascadeMC_HistBank> banks;
+      // Initial states simulated so far; the index is the initial state ID
+      static std::vector<std::string> initialStates;
+      const std::vector<std::string> &finalStates = *Dep::cascadeMC_FinalStates;
 
       switch(*Loop::iteration)
       {
@@ -405,12 +443,15 @@ namespace Gambit
           /// Option cMC_binHigh<double>: Histogram max energy in GeV (default 10000)
           cMC_binHigh = runOptions->getValueOrDef<double>(10000.0,"cMC_binHigh");
           histList.clear();
+          banks.assign(omp_get_max_threads(), cascadeMC_HistBank());
+          initialStates.clear();
           return;
         case MC_NEXT_STATE:
+        {
           // Initialize histograms
+          std::vector<SimpleHist> emptyHists;
           for(std::vector<std::string>::const_iterator it =
-              Dep::cascadeMC_FinalStates->begin();
-              it!=Dep::cascadeMC_FinalStates->end(); ++it)
+              finalStates.begin(); it!=finalStates.end(); ++it)
           {
 #ifdef DARKBIT_DEBUG
             std::cout << "Defining new histList entry!!!" << std::endl;
@@ -419,23 +460,54 @@ namespace Gambit
 #endif
             histList[*Dep::cascadeMC_InitialState][*it]=
               SimpleHist(cMC_NhistBins,cMC_binLow,cMC_binHigh,true);
+            emptyHists.push_back(histList[*Dep::cascadeMC_InitialState][*it]);
+          }
+          initialStates.push_back(*Dep::cascadeMC_InitialState);
+          for(std::vector<cascadeMC_HistBank>::iterator bank = banks.begin();
+              bank != banks.end(); ++bank)
+          {
+            bank->hists.push_back(emptyHists);
+            bank->unmerged = 0;
+            bank->mergedPeriod = 0;
           }
+          mergedEvents = 0;
           return;
+        }
         case MC_FINALIZE:
+          // Reduce whatever is left in the thread-private banks.  No events
+          // are being generated at this point, so no locking is needed.
+          for(std::vector<cascadeMC_HistBank>::iterator bank = banks.begin();
+              bank != banks.end(); ++bank)
+          {
+            for(size_t id=0; id<initialStates.size(); id++)
+              cascadeMC_mergeHists(bank->hists[id], histList[initialStates[id]],
+                  finalStates);
+          }
           // For performance, only return the actual result once finished
           result = histList;
           return;
       }
 
+      // This thread's histograms for the current initial state
+      const size_t thread = omp_get_thread_num();
+      if(thread >= banks.size() or initialStates.empty())
+      {
+        Loop::wrapup();
+        piped_errors.request(LOCAL_INFO,
+            "cascadeMC_Histograms has no histogram bank for this thread.");
+        return;
+      }
+      cascadeMC_HistBank &bank = banks[thread];
+      std::vector<SimpleHist> &hists = bank.hists[initialStates.size()-1];
+
       // Get list of endpoint states for this chain
       vector<const ChainParticle*> endpoints;
       (*Dep::cascadeMC_ChainEvent).chain->
         collectEndpointStates(endpoints, false);
       // Iterate over final states of interest
-      for(std::vector<std::string>::const_iterator pit =
-          Dep::cascadeMC_FinalStates->begin();
-          pit!=Dep::cascadeMC_FinalStates->end(); ++pit)
+      for(size_t f=0; f<finalStates.size(); f++)
       {
+        const std::string &finalState = finalStates[f];
         // Iterate over all endpoint states of the decay chain. These can
         // either be final state particles themselves or parents of final state
         // particles.  The reason for not using only final state particles is
@@ -459,20 +531,18 @@ namespace Gambit
             weight = (*it)->getWeight();
             // Check if the final state itself is the particle we are looking
             // for.
-            if((*it)->getpID()==*pit)
+            if((*it)->getpID()==finalState)
             {
               double E = (*it)->E_Lab();
-#pragma omp critical (cascadeMC_histList)
-              histList[*Dep::cascadeMC_InitialState][*pit].addEvent(E,weight);
+              hists[f].addEvent(E,weight);
               ignored = false;
             }
             // Check if tabulated spectra exist for this final state
-            else if((*Dep::SimYieldTable).hasChannel( (*it)->getpID(), *pit ))
+            else if((*Dep::SimYieldTable).hasChannel( (*it)->getpID(), finalState ))
             {
               cascadeMC_sampleSimYield(
-                  *Dep::SimYieldTable, *it, *pit, *Dep::TH_ProcessCatalog,
-                  histList, *Dep::cascadeMC_InitialState, weight,
-                  cMC_numSpecSamples
+                  *Dep::SimYieldTable, *it, finalState, *Dep::TH_ProcessCatalog,
+                  hists[f], weight, cMC_numSpecSamples
                   );
               // Check if an error was raised
               ignored = false;
@@ -498,12 +568,11 @@ namespace Gambit
 #endif
               // Check if tabulated spectra exist for this final state
               if((*Dep::SimYieldTable).hasChannel(
-                    (*(*it))[0]->getpID() , (*(*it))[1]->getpID(), *pit ))
+                    (*(*it))[0]->getpID() , (*(*it))[1]->getpID(), finalState ))
               {
                 hasTabulated = true;
-                cascadeMC_sampleSimYield(*Dep::SimYieldTable, *it, *pit,
-                    *Dep::TH_ProcessCatalog, histList,
-                    *Dep::cascadeMC_InitialState, weight,
+                cascadeMC_sampleSimYield(*Dep::SimYieldTable, *it, finalState,
+                    *Dep::TH_ProcessCatalog, hists[f], weight,
                     cMC_numSpecSamples
                     );
                 // Check if an error was raised
@@ -522,21 +591,18 @@ namespace Gambit
                 const ChainParticle* child = (*(*it))[i];
                 // Check if the child particle is the particle we are looking
                 // for.
-                if(child->getpID()==*pit)
+                if(child->getpID()==finalState)
                 {
                   double E = child->E_Lab();
-#pragma omp critical (cascadeMC_histList)
-                  histList[
-                    *Dep::cascadeMC_InitialState][*pit].addEvent(E,weight);
+                  hists[f].addEvent(E,weight);
                   ignored = false;
                 }
                 // Check if tabulated spectra exist for this final state
                 else if((*Dep::SimYieldTable).hasChannel( child->getpID(),
-                      *pit))
+                      finalState))
                 {
-                  cascadeMC_sampleSimYield(*Dep::SimYieldTable, child, *pit,
-                      *Dep::TH_ProcessCatalog, histList,
-                      *Dep::cascadeMC_InitialState, weight,
+                  cascadeMC_sampleSimYield(*Dep::SimYieldTable, child, finalState,
+                      *Dep::TH_ProcessCatalog, hists[f], weight,
                       cMC_numSpecSamples
                       );
                   // Check if an error was raised
@@ -558,6 +624,22 @@ namespace Gambit
           }
         }
       }
+      // Merge this thread's histograms into the shared list whenever the global
+      // event number enters a new end-check period.  Every thread does this at
+      // its first event past each multiple of cMC_endCheckFrequency, so the
+      // shared list follows the same cadence as the end checks below.
+      bank.unmerged++;
+      const int period = *Loop::iteration / cMC_endCheckFrequency;
+      if(period > bank.mergedPeriod)
+      {
+#pragma omp critical (cascadeMC_histList)
+        {
+          cascadeMC_mergeHists(hists, histList[initialStates.back()], finalStates);
+          mergedEvents += bank.unmerged;
+        }
+        bank.unmerged = 0;
+        bank.mergedPeriod = period;
+      }
       // Check if finished every cMC_endCheckFrequency events
       if((*Loop::iteration % cMC_endCheckFrequency) == 0)
       {
@@ -571,8 +653,19 @@ namespace Gambit
           if(*it=="gamma")
           {
             SimpleHist hist;
+            int nMerged;
 #pragma omp critical (cascadeMC_histList)
-            hist = histList[*Dep::cascadeMC_InitialState][*it];
+            {
+              hist = histList[*Dep::cascadeMC_InitialState][*it];
+              nMerged = mergedEvents;
+            }
+            // Only events merged into the shared list are seen here; without
+            // any, an empty histogram would appear to have zero error.
+            if(nMerged == 0)
+            {
+              cond = unfinished;
+              continue;
+            }
 #ifdef DARKBIT_DEBUG
             std::cout << "Checking whether convergence is reached" << std::endl;
             for ( int i = 0; i < hist.nBins; i++ )
@@ -88,7 +88,7 @@ namespace Gambit
     /// Sim yield table dummy constructor
     SimYieldTable::SimYieldTable() : dummy_channel(daFunk::zero("E", "Ecm"), "", "", "", 0.0, 0.0) {}
     
-    void SimYieldTable::addChannel(daFunk::Funk dNdE, std::string p1, std::string p2, std::string finalState, double Ecm_min, double Ecm_max)
+    void SimYieldTable::addChannel(daFunk::Funk dNdE, const std::string& p1, const std::string& p2, const std::string& finalState, double Ecm_min, double Ecm_max)
     {
       if ( hasChannel(p1, p2) )
       {
@@ -96,42 +96,36 @@ namespace Gambit
         return;
       }
       channel_list.push_back(SimYieldChannel(dNdE, p1, p2, finalState, Ecm_min, Ecm_max));
+      channel_index.insert(p1, p2, finalState, channel_list.size()-1);
+      initial_state_index.insert(p1, p2, channel_list.size()-1);
     }
     
-    void SimYieldTable::addChannel(daFunk::Funk dNdE, std::string p1, std::string finalState, double Ecm_min, double Ecm_max)
+    void SimYieldTable::addChannel(daFunk::Funk dNdE, const std::string& p1, const std::string& finalState, double Ecm_min, double Ecm_max)
     {
       addChannel(dNdE, p1, "", finalState, Ecm_min, Ecm_max);
     }
     
-    bool SimYieldTable::hasChannel(std::string p1, std::string p2, std::string finalState) const
+    bool SimYieldTable::hasChannel(const std::string& p1, const std::string& p2, const std::string& finalState) const
     {
       return ( findChannel(p1, p2, finalState) != -1 );
     }
     
-    bool SimYieldTable::hasChannel(std::string p1, std::string finalState) const
+    bool SimYieldTable::hasChannel(const std::string& p1, const std::string& finalState) const
     {
       return hasChannel(p1, "", finalState);
     }
     
-    bool SimYieldTable::hasAnyChannel(std::string p1) const
+    bool SimYieldTable::hasAnyChannel(const std::string& p1) const
     {
       return hasAnyChannel(p1, "");
     }
     
-    bool SimYieldTable::hasAnyChannel(std::string p1, std::string p2) const
+    bool SimYieldTable::hasAnyChannel(const std::string& p1, const std::string& p2) const
     {
-      const std::vector<SimYieldChannel> &cl = channel_list;
-      for ( unsigned int i = 0; i < channel_list.size(); i++ )
-      {
-        if ((p1==cl[i].p1 and p2==cl[i].p2) or (p1==cl[i].p2 and p2==cl[i].p1) )
-        {
-          return true;
-        }
-      }
-      return false;
+      return ( initial_state_index.find(p1, p2) != -1 );
     }
     
-    const SimYieldChannel& SimYieldTable::getChannel(std::string p1, std::string p2, std::string finalState) const
+    const SimYieldChannel& SimYieldTable::getChannel(const std::string& p1, const std::string& p2, const std::string& finalState) const
     {
       int index = findChannel(p1, p2, finalState);
       if ( index == -1 )
@@ -143,19 +137,19 @@ namespace Gambit
     }
     
     /// Retrieve simyield table entries at given center of mass energy (GeV)
-    daFunk::Funk SimYieldTable::operator()(std::string p1, std::string p2, std::string finalState, double Ecm) const
+    daFunk::Funk SimYieldTable::operator()(const std::string& p1, const std::string& p2, const std::string& finalState, double Ecm) const
     {
       return this->operator()(p1, p2, finalState)->set("Ecm", Ecm);
     }
     
     /// Retrieve simyield table entries at given center of mass energy (GeV)
-    daFunk::Funk SimYieldTable::operator()(std::string p1, std::string finalState, double Ecm) const
+    daFunk::Funk SimYieldTable::operator()(const std::string& p1, const std::string& finalState, double Ecm) const
     {
       return this->operator()(p1,finalState)->set("Ecm", Ecm);
     }
     
     /// Retrieve simyield table entries at given center of mass energy (GeV)
-    daFunk::Funk SimYieldTable::operator()(std::string p1, std::string p2, std::string finalState) const
+    daFunk::Funk SimYieldTable::operator()(const std::string& p1, const std::string& p2, const std::string& finalState) const
     {
       int index = findChannel(p1, p2, finalState);
       if ( index == -1 )
@@ -166,22 +160,14 @@ namespace Gambit
       return channel_list[index].dNdE;
     }
     
-    daFunk::Funk SimYieldTable::operator()(std::string p1, std::string finalState) const
+    daFunk::Funk SimYieldTable::operator()(const std::string& p1, const std::string& finalState) const
     {
       return this->operator()(p1, "", finalState);
     }
     
-    int SimYieldTable::findChannel(std::string p1, std::string p2, std::string finalState) const
+    int SimYieldTable::findChannel(const std::string& p1, const std::string& p2, const std::string& finalState) const
     {
-      const std::vector<SimYieldChannel> &cl = channel_list;
-      for ( unsigned int i = 0; i < channel_list.size(); i++ )
-      {
-        if ((p1==cl[i].p1 and p2==cl[i].p2 and finalState==cl[i].finalState) or (p1==cl[i].p2 and p2==cl[i].p1 and finalState==cl[i].finalState) )
-        {
-          return i;
-        }
-      }
-      return -1;
+      return channel_index.find(p1, p2, finalState);
     }
 
   }
@@ -24,6 +24,70 @@
 namespace Gambit {
   namespace DarkBit {
 
+    // TH_ParticleIndex definitions
+
+    /// Record position pos under the key given by a list of names
+    void TH_ParticleIndex::insert(const std::vector<str>& names, int pos)
+    {
+      if (names.size() > maxNames) return;
+      const str* n[maxNames];
+      for (size_t i = 0; i < names.size(); i++) n[i] = &names[i];
+      insert(n, names.size(), pos);
+    }
+
+    /// Position recorded under the key given by a list of names, or -1 if there is none
+    int TH_ParticleIndex::find(const std::vector<str>& names) const
+    {
+      if (names.size() > maxNames) return -1;
+      const str* n[maxNames];
+      for (size_t i = 0; i < names.size(); i++) n[i] = &names[i];
+      return find(n, names.size());
+    }
+
+    /// Record position pos under the key given by names[0..n-1], interning any new names
+    void TH_ParticleIndex::insert(const str* const* names, size_t n, int pos)
+    {
+      unsigned int keyIDs[maxNames];
+      for (size_t i = 0; i < n; i++)
+      {
+        auto it = ids.find(*names[i]);
+        if (it == ids.end())
+        {
+          if (ids.size() >= noName) DarkBit_error().raise(LOCAL_INFO, "Too many particle names for TH_ParticleIndex.");
+          it = ids.emplace(*names[i], ids.size()).first;
+        }
+        keyIDs[i] = it->second;
+      }
+      positions.emplace(key(keyIDs, n), pos);
+    }
+
+    /// Position recorded under the key given by names[0..n-1], or -1 if there is none
+    int TH_ParticleIndex::find(const str* const* names, size_t n) const
+    {
+      unsigned int keyIDs[maxNames];
+      for (size_t i = 0; i < n; i++)
+      {
+        auto it = ids.find(*names[i]);
+        if (it == ids.end()) return -1;
+        keyIDs[i] = it->second;
+      }
+      auto it = positions.find(key(keyIDs, n));
+      return (it == positions.end()) ? -1 : it->second;
+    }
+
+    /// Pack the IDs of one key into a single integer, 16 bits per name
+    unsigned long long TH_ParticleIndex::key(unsigned int* keyIDs, size_t n) const
+    {
+      std::sort(keyIDs, keyIDs + std::min<size_t>(nSymmetric, n));
+      unsigned long long k = 0;
+      for (size_t i = 0; i < maxNames; i++)
+      {
+        k = (k << 16) | (i < n ? keyIDs[i] : unsigned(noName));
+      }
+      return k;
+    }
+
+
     // TH_ParticleProperty definitions
 
     TH_ParticleProperty::TH_ParticleProperty(double mass, unsigned int spin2)
@@ -122,6 +186,11 @@ namespace Gambit {
     /// Check for given channel.  Return a pointer to it if found, NULL if not.
     const TH_Channel* TH_Process::find(std::vector<str> final_states) const
     {
+      if (channelIndexSize == channelList.size() and final_states.size() <= TH_ParticleIndex::maxNames)
+      {
+        int i = channelIndex.find(final_states);
+        return (i == -1) ? NULL : &channelList[i];
+      }
       for (auto it = channelList.begin(); it != channelList.end(); ++it)
       {
         if (it->isChannel(final_states)) return &(*it);
@@ -130,6 +199,18 @@ namespace Gambit {
     }
 
 
+    /// Index channelList by final states
+    void TH_Process::buildIndex()
+    {
+      channelIndex.clear();
+      for (size_t i = 0; i < channelList.size(); i++)
+      {
+        channelIndex.insert(channelList[i].finalStateIDs, i);
+      }
+      channelIndexSize = channelList.size();
+    }
+
+
     // TH_ProcessCatalog definitions
 
     /// Retrieve a specific process from the catalog
@@ -147,6 +228,11 @@ namespace Gambit {
     /// Check for a specific process in the catalog
     const TH_Process* TH_ProcessCatalog::find(str id1, str id2) const
     {
+      if (processIndexSize == processList.size())
+      {
+        int i = processIndex.find(id1, id2);
+        return (i == -1) ? NULL : &processList[i];
+      }
       for (std::vector<TH_Process>::const_iterator it = processList.begin();
           it != processList.end(); ++it)
       {
@@ -177,6 +263,18 @@ namespace Gambit {
     }
 
 
+    /// Index processList by initial states, and each process by final states
+    void TH_ProcessCatalog::buildIndex()
+    {
+      processIndex.clear();
+      for (size_t i = 0; i < processList.size(); i++)
+      {
+        processIndex.insert(processList[i].particle1ID, processList[i].particle2ID, i);
+        processList[i].buildIndex();
+      }
+      processIndexSize = processList.size();
+    }
+
     void TH_ProcessCatalog::validate()
     {
 #ifdef DARKBIG_DEBUG
@@ -323,6 +421,10 @@ namespace Gambit {
           }
         }
       }
+
+      // The catalog is complete, so index it for find()
+      buildIndex();
+
 #ifdef DARKBIT_DEBUG
       std::cout << std::endl;
       std::cout << "*****************" << std::endl;
@@ -66,6 +66,7 @@ namespace Gambit {
         }
         binLower.push_back(Emin+nBins*dE);
       }
+      setBinWidths();
     }
 
     SimpleHist::SimpleHist(std::vector<double> binLower) : binLower(binLower)
@@ -73,6 +74,16 @@ namespace Gambit {
       nBins=int(binLower.size())-1;
       binVals=std::vector<double>(nBins,0.0);
       wtSq   =std::vector<double>(nBins,0.0);
+      setBinWidths();
+    }
+
+    void SimpleHist::setBinWidths()
+    {
+      binWidths.resize(nBins);
+      for(int i=0; i<nBins; i++)
+      {
+        binWidths[i] = binLower[i+1]-binLower[i];
+      }
     }
 
     void SimpleHist::addEvent(double E, double weight)
@@ -94,7 +105,12 @@ namespace Gambit {
     void SimpleHist::addBox(double Emin, double Emax, double weight)
     {
       int imin = findIndex(Emin);
-      int imax = findIndex(Emax);
+      int imax;
+      // Every edge below bin imin is <= Emin, so the search for Emax can start there
+      if(imin>=0 and Emax>=Emin)
+        imax = upper_bound(binLower.begin()+imin,binLower.end(),Emax) - binLower.begin() - 1;
+      else
+        imax = findIndex(Emax);
       double dE = Emax-Emin;
       double norm = weight/dE;
       if(imax<0 or imin>=nBins)
@@ -122,7 +138,7 @@ namespace Gambit {
         else
         {
           imin = 0;
-          binSize_low=binSize(imin);
+          binSize_low=binWidths[imin];
         }
         // Calculate part of upper bin covered by box
         if(imax<nBins)
@@ -130,16 +146,20 @@ namespace Gambit {
         else
         {
           imax = nBins-1;
-          binSize_high=binSize(imax);
+          binSize_high=binWidths[imax];
         }
         // Add contribution to lower bin
         addToBin(imin,binSize_low*norm);
         // Add contribution to upper bin
         addToBin(imax,binSize_high*norm);
-        // Add contributions to remaining bins
+        // Add contributions to remaining bins, which are fully covered
+        const double *widths = binWidths.data();
+        double *vals = binVals.data(), *sq = wtSq.data();
         for(int i=imin+1;i<imax;i++)
         {
-          addToBin(i,binSize(i)*norm);
+          const double w = widths[i]*norm;
+          vals[i]+=w;
+          sq[i]+=w*w;
         }
       }
     }
@@ -154,12 +174,38 @@ namespace Gambit {
             "SimpleHist::addHistAsWeights_sameBin requires identically binned\n"
             "histograms.");
       }
+      const double *in_vals = in.binVals.data();
+      double *vals = binVals.data(), *sq = wtSq.data();
       for(int i=0; i<nBins;i++)
       {
-        addToBin(i,in.binVals[i]);
+        const double w = in_vals[i];
+        vals[i]+=w;
+        sq[i]+=w*w;
       }
     }
 
+    void SimpleHist::addHist(const SimpleHist &in)
+    {
+      if(in.nBins != nBins)
+      {
+        DarkBit_error().raise(LOCAL_INFO,
+            "SimpleHist::addHist requires identically binned histograms.");
+      }
+      const double *in_vals = in.binVals.data(), *in_sq = in.wtSq.data();
+      double *vals = binVals.data(), *sq = wtSq.data();
+      for(int i=0; i<nBins;i++)
+      {
+        vals[i]+=in_vals[i];
+        sq[i]+=in_sq[i];
+      }
+    }
+
+    void SimpleHist::reset()
+    {
+      std::fill(binVals.begin(), binVals.end(), 0.0);
+      std::fill(wtSq.begin(), wtSq.end(), 0.0);
+    }
+
     double SimpleHist::getError(int bin) const
     {
       return sqrt(wtSq[bin]);
@@ -172,19 +218,23 @@ namespace Gambit {
 
     void SimpleHist::divideByBinSize()
     {
+      const double *widths = binWidths.data();
+      double *vals = binVals.data(), *sq = wtSq.data();
       for(int i=0;i<nBins;i++)
       {
-        binVals[i]/=binSize(i);
-        wtSq[i]   /=(binSize(i)*binSize(i));
+        vals[i]/=widths[i];
+        sq[i]  /=(widths[i]*widths[i]);
       }
     }
 
     void SimpleHist::multiply(double x)
     {
+      const double x2 = x*x;
+      double *vals = binVals.data(), *sq = wtSq.data();
       for(int i=0;i<nBins;i++)
       {
-        binVals[i]*=x;
-        wtSq[i]   *=x*x;
+        vals[i]*=x;
+        sq[i]  *=x2;
       }
     }
 
@@ -198,7 +248,7 @@ namespace Gambit {
 
     double SimpleHist::binSize(int bin) const
     {
-      return binLower[bin+1]-binLower[bin];
+      return binWidths[bin];
     }
 
     double SimpleHist::binCenter(int bin) const
@@ -209,6 +259,7 @@ namespace Gambit {
     std::vector<double> SimpleHist::getBinCenters() const
     {
       std::vector<double> centers;
+      centers.reserve(nBins);
       for(int i=0;i<nBins;i++)
       {
         centers.push_back(binCenter(i));
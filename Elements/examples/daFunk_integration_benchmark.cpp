@@ -0,0 +1,85 @@
+//   GAMBIT: Global and Modular BSM Inference Tool
+//   *********************************************
+///  \file
+///
+///  Stand-alone benchmark for the thread scaling
+///  of daFunk GSL integrals.
+///
+///  Evaluates a bound daFunk integral at a set of
+///  points inside an OpenMP parallel loop, for two
+///  kinds of integrand:
+///
+///   cpu     - pure arithmetic, so scaling is
+///             limited by the number of cores
+///   latency - each call waits for a fixed time
+///             (like a slow backend), so scaling
+///             shows whether integrals on different
+///             threads are serialised
+///
+///  Build with "make daFunk_benchmark", then run
+///  e.g.
+///
+///    for n in 1 2 4 8; do
+///      OMP_NUM_THREADS=$n Elements/bin/daFunk_benchmark
+///    done
+///
+///  Optional arguments: number of points (default
+///  64) and latency per integrand call in
+///  microseconds (default 20).
+///
+///  *********************************************
+
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <thread>
+#include <omp.h>
+
+#include "gambit/Elements/daFunk.hpp"
+
+// Annoying other things we need due to mostly unwanted dependencies
+#include "gambit/Utils/static_members.hpp"
+
+using namespace daFunk;
+
+/// Latency of the slow integrand, in microseconds
+static int latency_us = 20;
+
+/// Integrand with a fixed latency per call
+double slow_integrand(double x, double m)
+{
+  std::this_thread::sleep_for(std::chrono::microseconds(latency_us));
+  return std::exp(-x*m)*std::sin(10*x+m);
+}
+
+/// Time the evaluation of f at n points, and report the time and a checksum
+void run(const std::string& name, Funk f, int n)
+{
+  BoundFunk fb = f->bind("m");
+  std::vector<double> out(n);
+  std::chrono::time_point<std::chrono::steady_clock> start = std::chrono::steady_clock::now();
+  #pragma omp parallel for schedule(dynamic)
+  for (int i = 0; i < n; i++) out[i] = fb->eval(0.5 + i*0.1);
+  std::chrono::duration<double> interval = std::chrono::steady_clock::now() - start;
+  double sum = 0;
+  for (double v : out) sum += v;
+  std::cout << "  " << std::left << std::setw(8) << name << std::right << std::setw(10) << std::fixed
+            << std::setprecision(3) << interval.count() << " s   checksum " << std::setprecision(12)
+            << sum << std::endl;
+}
+
+int main(int argc, char* argv[])
+{
+  int n = (argc > 1) ? std::atoi(argv[1]) : 64;
+  if (argc > 2) latency_us = std::atoi(argv[2]);
+
+  std::cout << "daFunk integration benchmark: " << omp_get_max_threads() << " threads, "
+            << std::thread::hardware_concurrency() << " hardware threads, " << n << " points" << std::endl;
+
+  Funk x = var("x"), m = var("m");
+  run("cpu", (exp(-x*m)*sin(x*10.0+m))->gsl_integration("x", 0, 5)->set_epsrel(1e-8)->set_epsabs(0), n);
+  run("latency", func_fromThreadsafe(slow_integrand, x, m)->gsl_integration("x", 0, 5)->set_epsrel(1e-3)->set_epsabs(1e-3), n);
+
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,167 @@
+//   GAMBIT: Global and Modular BSM Inference Tool
+//   *********************************************
+///  \file
+///
+///  Stand-alone test of the memoisation of module
+///  function results.
+///
+///  Sets up a small dependency tree by hand,
+///
+///    A_parameters  (m) -> mass -> width -> likelihood
+///    nuisance_parameters (n) ---------------^
+///    file_spectrum -> decays
+///
+///  with width and decays memoised and mass declared
+///  pure, and evaluates it at a sequence of points.
+///  Where only the nuisance parameter n changes, width
+///  must be restored from the memo store rather than
+///  recalculated (mass is not memoised, so this also
+///  checks that the fingerprint of a pure function
+///  follows its inputs), and every result must be the
+///  same as if it had been recalculated.  file_spectrum
+///  has no dependencies but reads a new value at every
+///  point (like a spectrum read from a list of files),
+///  so decays must be recalculated at every point.
+///
+///  Build with "make functor_memoisation_test", then
+///  run Elements/bin/functor_memoisation_test.  The
+///  exit code is non-zero if the test fails.
+///
+///  *********************************************
+
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+
+#include "gambit/Elements/functors.hpp"
+#include "gambit/Elements/functor_definitions.hpp"
+#include "gambit/Models/models.hpp"
+
+// Annoying other things we need due to mostly unwanted dependencies
+#include "gambit/Utils/static_members.hpp"
+
+using namespace Gambit;
+
+namespace MemoTest
+{
+  /// Functors resolved as dependencies
+  model_functor* A_parameters = NULL;
+  model_functor* nuisance_parameters = NULL;
+  module_functor<double>* mass_functor = NULL;
+  module_functor<double>* width_functor = NULL;
+  module_functor<double>* spectrum_functor = NULL;
+
+  /// Number of times each module function has actually been run
+  int mass_calls = 0, width_calls = 0, likelihood_calls = 0, decays_calls = 0;
+
+  /// Module functions
+  /// @{
+  void no_parameters(ModelParameters&) {}
+  void mass(double& result) { mass_calls++; result = 2.0 * A_parameters->valuePtr()->at("m"); }
+  void width(double& result) { width_calls++; result = 0.1 * (*mass_functor)(0) * (*mass_functor)(0); }
+  void likelihood(double& result) { likelihood_calls++; result = (*width_functor)(0) - nuisance_parameters->valuePtr()->at("n"); }
+  void file_spectrum(double& result) { static int counter = 0; result = 10.0 * ++counter; }
+  void decays(double& result) { decays_calls++; result = 0.5 * (*spectrum_functor)(0); }
+  /// @}
+
+  /// Dependency resolvers
+  /// @{
+  void resolve_A(functor* f, module_functor_common*) { A_parameters = dynamic_cast<model_functor*>(f); }
+  void resolve_nuisance(functor* f, module_functor_common*) { nuisance_parameters = dynamic_cast<model_functor*>(f); }
+  void resolve_mass(functor* f, module_functor_common*) { mass_functor = dynamic_cast<module_functor<double>*>(f); }
+  void resolve_width(functor* f, module_functor_common*) { width_functor = dynamic_cast<module_functor<double>*>(f); }
+  void resolve_spectrum(functor* f, module_functor_common*) { spectrum_functor = dynamic_cast<module_functor<double>*>(f); }
+  /// @}
+}
+
+// Define standalone versions of functor signal helpers (that do nothing)
+namespace Gambit
+{
+  namespace FunctorHelp
+  {
+    void entering_multithreaded_region(module_functor_common&) {}
+    void leaving_multithreaded_region(module_functor_common&) {}
+  }
+}
+
+int main()
+{
+  using namespace MemoTest;
+
+  Models::ModelFunctorClaw claw;
+  primary_model_functor A(&no_parameters, "A_parameters", "A_parameters", "ModelParameters", "A", claw);
+  primary_model_functor nuisance(&no_parameters, "nuisance_parameters", "nuisance_parameters", "ModelParameters", "nuisance", claw);
+  A.addParameter("m");
+  nuisance.addParameter("n");
+
+  module_functor<double> m(&mass, "mass", "mass", "double", "MemoTest", claw);
+  module_functor<double> w(&width, "width", "width", "double", "MemoTest", claw);
+  module_functor<double> L(&likelihood, "likelihood", "likelihood", "double", "MemoTest", claw);
+  module_functor<double> S(&file_spectrum, "file_spectrum", "spectrum", "double", "MemoTest", claw);
+  module_functor<double> D(&decays, "decays", "decays", "double", "MemoTest", claw);
+  m.setDependency("A_parameters", "ModelParameters", &resolve_A);
+  w.setDependency("mass", "double", &resolve_mass);
+  L.setDependency("width", "double", &resolve_width);
+  L.setDependency("nuisance_parameters", "ModelParameters", &resolve_nuisance);
+  m.resolveDependency(&A);
+  w.resolveDependency(&m);
+  L.resolveDependency(&w);
+  L.resolveDependency(&nuisance);
+  D.setDependency("spectrum", "double", &resolve_spectrum);
+  D.resolveDependency(&S);
+  m.setPure(true);
+  w.setMemoisation(4);
+  D.setMemoisation(4);
+
+  // Points to evaluate (m, n), and whether width should be reused from the memo store at each
+  const int npoints = 6;
+  const double points[npoints][2] = {{1.0, 0.0}, {1.0, 0.5}, {1.0, 0.7}, {2.0, 0.7}, {1.0, 0.2}, {2.0, 0.3}};
+  const bool reused[npoints] = {false, true, true, false, true, true};
+
+  bool pass = true;
+  for (int i = 0; i < npoints; ++i)
+  {
+    const double mval = points[i][0], nval = points[i][1];
+    A.getcontentsPtr()->setValue("m", mval);
+    nuisance.getcontentsPtr()->setValue("n", nval);
+    m.reset();
+    w.reset();
+    L.reset();
+    S.reset();
+    D.reset();
+
+    const int calls_before = width_calls, decays_calls_before = decays_calls;
+    m.calculate();
+    w.calculate();
+    L.calculate();
+    S.calculate();
+    D.calculate();
+
+    const double expected = 0.1 * 4.0 * mval * mval - nval;
+    const bool hit = (width_calls == calls_before);
+    std::cout << "  point " << i << ": m = " << mval << ", n = " << nval << ", likelihood = " << L(0)
+              << " (expected " << expected << "), width " << (hit ? "reused" : "recalculated") << std::endl;
+    if (hit != reused[i])
+    {
+      std::cout << "    FAIL: width should have been " << (reused[i] ? "reused" : "recalculated") << std::endl;
+      pass = false;
+    }
+    if (std::abs(L(0) - expected) > 1e-12)
+    {
+      std::cout << "    FAIL: wrong likelihood" << std::endl;
+      pass = false;
+    }
+    if (decays_calls == decays_calls_before or std::abs(D(0) - 5.0 * (i+1)) > 1e-12)
+    {
+      std::cout << "    FAIL: decays should have been recalculated from the new spectrum" << std::endl;
+      pass = false;
+    }
+  }
+
+  std::cout << "mass calculated " << mass_calls << " times, width " << width_calls << " times (" << w.getMemoisationHits()
+            << " memoisation hits, " << w.getMemoisationMisses() << " misses), likelihood " << likelihood_calls << " times" << std::endl;
+  if (mass_calls != npoints or likelihood_calls != npoints or decays_calls != npoints) pass = false;
+
+  std::cout << (pass ? "PASSED" : "FAILED") << std::endl;
+  return pass ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -59,6 +59,7 @@
 #include <map>
 #include <set>
 #include <cmath>
+#include <cstdint>
 
 //#define NDEBUG
 #include <assert.h>
@@ -109,6 +110,7 @@ namespace daFunk
 
     class FunkBase;
     class FunkBound;
+    class FunkPlan;
     class FunkIntegrate_gsl1d;
 
     typedef shared_ptr<FunkBase> Funk;
@@ -328,6 +330,11 @@ namespace daFunk
             // parallel with the same Funk objects.
             virtual void resolve(std::map<std::string, size_t> datamap, size_t & datalen, size_t bindID, std::map<std::string,size_t> &argmap);
 
+            // Append the instructions that evaluate this object (resolved for
+            // bindID) to a flat evaluation plan, and return the register that
+            // holds the result.  The default is a plain call of value().
+            virtual size_t compile(FunkPlan & plan, size_t bindID);
+
 
             // Singularities handling
             Singularities getSingl() { return singularities; }
@@ -371,6 +378,182 @@ namespace daFunk
             Singularities singularities;
     };
 
+    //
+    // Flattened evaluation plan
+    //
+    // A bound Funk is compiled once into a flat list of register-machine
+    // instructions, which is then run without walking the tree of
+    // shared_ptr<FunkBase> objects.  Every instruction writes its own
+    // register.  The data slots (bound arguments plus the extra slots
+    // requested during resolve()) are kept apart from the registers, so that
+    // objects without native instructions are simply called on them (CALL).
+    //
+
+    class FunkPlan
+    {
+        public:
+            enum OpCode { CONST, LOAD, STORE, MOVE, CALL, CALL_SUB, NEG, UNARY, ADD, SUB, MUL, DIV, BINARY, JUMP, JUMP_UNLESS_NONNEG };
+
+            // Evaluator for CALL_SUB: an object evaluated with the help of a sub-plan
+            typedef double (*SubCall)(FunkBase *, const std::vector<double> &, size_t, const FunkPlan &);
+
+            struct Instruction
+            {
+                OpCode op;
+                size_t out;  // Output register (data slot for STORE, target for jumps)
+                size_t a;    // First input register (data slot for LOAD)
+                size_t b;    // Second input register
+                double c;    // Value for CONST
+                double (*f1)(double);
+                double (*f2)(double, double);
+                FunkBase * f;  // Object evaluated by CALL and CALL_SUB
+                SubCall g;     // Evaluator for CALL_SUB
+                const FunkPlan * sub;  // Sub-plan handed to g
+            };
+
+            FunkPlan() : nregs(0), result(0), datalen(0), bindID(0), branches(false) {}
+
+            // Compile f, resolved for bindID, with datalen data slots
+            void compile(FunkBase * f, size_t datalen, size_t bindID);
+            bool empty() const { return code.empty(); }
+
+            // Instruction emitters; all return the output register
+            size_t constant(double c) { Instruction i = make(CONST); i.c = c; return push(i); }
+            size_t load(size_t slot) { Instruction i = make(LOAD); i.a = slot; return push(i); }
+            size_t call(FunkBase * f) { Instruction i = make(CALL); i.f = f; return push(i); }
+            size_t call(FunkBase * f, SubCall g, const FunkPlan & sub) { Instruction i = make(CALL_SUB); i.f = f; i.g = g; i.sub = &sub; return push(i); }
+            size_t neg(size_t a) { Instruction i = make(NEG); i.a = a; return push(i); }
+            size_t unary(double (*f1)(double), size_t a) { Instruction i = make(UNARY); i.f1 = f1; i.a = a; return push(i); }
+            size_t binary(OpCode op, size_t a, size_t b) { Instruction i = make(op); i.a = a; i.b = b; return push(i); }
+            size_t binary(double (*f2)(double, double), size_t a, size_t b) { Instruction i = make(BINARY); i.f2 = f2; i.a = a; i.b = b; return push(i); }
+            void store(size_t slot, size_t a) { Instruction i = make(STORE); i.out = slot; i.a = a; code.push_back(i); }
+
+            // Control flow (for FunkIfElse): jumps return their position,
+            // which is patched to the current end of the code by land().
+            size_t newRegister() { return nregs++; }
+            void move(size_t out, size_t a) { Instruction i = make(MOVE); i.out = out; i.a = a; code.push_back(i); }
+            size_t jump(OpCode op, size_t a = 0) { Instruction i = make(op); i.a = a; code.push_back(i); branches = true; return code.size() - 1; }
+            void land(size_t pos) { code[pos].out = code.size(); }
+
+            // A new plan owned by this one, e.g. for the integrand of an
+            // integral.  It lives (at a fixed address) as long as this plan.
+            FunkPlan & subplan() { subplans.push_back(shared_ptr<FunkPlan>(new FunkPlan)); return *subplans.back(); }
+
+            // Evaluate a single point
+            double run(std::vector<double> & data) const
+            {
+                double fixed[64];
+                std::vector<double> heap;
+                double * r = fixed;
+                if ( nregs > 64 ) { heap.resize(nregs); r = &heap[0]; }
+                for ( size_t pc = 0; pc < code.size(); ++pc )
+                {
+                    const Instruction & i = code[pc];
+                    switch ( i.op )
+                    {
+                        case CONST:  r[i.out] = i.c; break;
+                        case LOAD:   r[i.out] = data[i.a]; break;
+                        case STORE:  data[i.out] = r[i.a]; break;
+                        case MOVE:   r[i.out] = r[i.a]; break;
+                        case CALL:   r[i.out] = i.f->value(data, bindID); break;
+                        case CALL_SUB: r[i.out] = i.g(i.f, data, bindID, *i.sub); break;
+                        case NEG:    r[i.out] = -r[i.a]; break;
+                        case UNARY:  r[i.out] = i.f1(r[i.a]); break;
+                        case ADD:    r[i.out] = r[i.a] + r[i.b]; break;
+                        case SUB:    r[i.out] = r[i.a] - r[i.b]; break;
+                        case MUL:    r[i.out] = r[i.a] * r[i.b]; break;
+                        case DIV:    r[i.out] = r[i.a] / r[i.b]; break;
+                        case BINARY: r[i.out] = i.f2(r[i.a], r[i.b]); break;
+                        case JUMP:   pc = i.out - 1; break;
+                        case JUMP_UNLESS_NONNEG: if ( not (r[i.a] >= 0.) ) pc = i.out - 1; break;
+                    }
+                }
+                return r[result];
+            }
+
+            // Evaluate n points at once.  data holds the data slots slot-major
+            // (data[slot*n + point]).  Points are processed in blocks, each
+            // instruction looping over the block; plans with data-dependent
+            // branches are run point by point.
+            std::vector<double> run(std::vector<double> & data, size_t n) const
+            {
+                std::vector<double> res(n);
+                std::vector<double> point(datalen);
+                if ( branches )
+                {
+                    for ( size_t p = 0; p < n; ++p )
+                    {
+                        for ( size_t s = 0; s < datalen; ++s ) point[s] = data[s*n + p];
+                        res[p] = run(point);
+                        for ( size_t s = 0; s < datalen; ++s ) data[s*n + p] = point[s];
+                    }
+                    return res;
+                }
+                const size_t B = 64;
+                std::vector<double> regs(nregs*B);
+                for ( size_t p0 = 0; p0 < n; p0 += B )
+                {
+                    const size_t w = std::min(B, n - p0);
+                    for ( auto i = code.begin(); i != code.end(); ++i )
+                    {
+                        double * o = &regs[0] + i->out*B;
+                        const double * x = &regs[0] + i->a*B;
+                        const double * y = &regs[0] + i->b*B;
+                        switch ( i->op )
+                        {
+                            case CONST:  for ( size_t l = 0; l < w; ++l ) o[l] = i->c; break;
+                            case LOAD:   for ( size_t l = 0; l < w; ++l ) o[l] = data[i->a*n + p0 + l]; break;
+                            case STORE:  for ( size_t l = 0; l < w; ++l ) data[i->out*n + p0 + l] = x[l]; break;
+                            case MOVE:   for ( size_t l = 0; l < w; ++l ) o[l] = x[l]; break;
+                            case CALL:
+                                for ( size_t l = 0; l < w; ++l )
+                                {
+                                    for ( size_t s = 0; s < datalen; ++s ) point[s] = data[s*n + p0 + l];
+                                    o[l] = i->f->value(point, bindID);
+                                }
+                                break;
+                            case CALL_SUB:
+                                for ( size_t l = 0; l < w; ++l )
+                                {
+                                    for ( size_t s = 0; s < datalen; ++s ) point[s] = data[s*n + p0 + l];
+                                    o[l] = i->g(i->f, point, bindID, *i->sub);
+                                }
+                                break;
+                            case NEG:    for ( size_t l = 0; l < w; ++l ) o[l] = -x[l]; break;
+                            case UNARY:  for ( size_t l = 0; l < w; ++l ) o[l] = i->f1(x[l]); break;
+                            case ADD:    for ( size_t l = 0; l < w; ++l ) o[l] = x[l] + y[l]; break;
+                            case SUB:    for ( size_t l = 0; l < w; ++l ) o[l] = x[l] - y[l]; break;
+                            case MUL:    for ( size_t l = 0; l < w; ++l ) o[l] = x[l] * y[l]; break;
+                            case DIV:    for ( size_t l = 0; l < w; ++l ) o[l] = x[l] / y[l]; break;
+                            case BINARY: for ( size_t l = 0; l < w; ++l ) o[l] = i->f2(x[l], y[l]); break;
+                            case JUMP:
+                            case JUMP_UNLESS_NONNEG: break;  // Not reached (branches)
+                        }
+                    }
+                    for ( size_t l = 0; l < w; ++l ) res[p0 + l] = regs[result*B + l];
+                }
+                return res;
+            }
+
+        private:
+            Instruction make(OpCode op)
+            {
+                Instruction i;
+                i.op = op; i.out = 0; i.a = 0; i.b = 0; i.c = 0;
+                i.f1 = NULL; i.f2 = NULL; i.f = NULL; i.g = NULL; i.sub = NULL;
+                return i;
+            }
+            size_t push(Instruction & i) { i.out = nregs++; code.push_back(i); return i.out; }
+
+            std::vector<Instruction> code;
+            std::vector<shared_ptr<FunkPlan>> subplans;
+            size_t nregs;
+            size_t result;
+            size_t datalen;
+            size_t bindID;
+            bool branches;
+    };
+
     // A vector class with global knowledge about its health status.
     // (BoundFunk objects are occasionally destructed *after* livingVector has
     // been destructed, causing segfaults if not catched properly.)
@@ -391,7 +574,10 @@ namespace daFunk
     class FunkBound
     {
         public:
-            FunkBound(Funk f, size_t datalen, size_t bindID) : f(f), datalen(datalen), bindID(bindID) {};
+            FunkBound(Funk f, size_t datalen, size_t bindID) : f(f), datalen(datalen), bindID(bindID)
+            {
+                plan.compile(&*f, datalen, bindID);
+            };
             ~FunkBound() {bindID_manager(bindID,false);};
             double value(std::vector<double> & map, size_t bindID) {(void)bindID; (void)map; return 0;};
 
@@ -399,7 +585,7 @@ namespace daFunk
             {
                 auto data = vec<double>(argss...);
                 data.resize(datalen);
-                return f->value(data, bindID);
+                return plan.run(data);
             }
 
             template <typename... Args> inline std::vector<double> vect(Args... argss)
@@ -461,21 +647,17 @@ namespace daFunk
                         return vec<double>();
                     }
                 }
-                auto r = vec<double>();
+                // Slot-major data for all points, evaluated as one batch
                 auto data = vec<double>();
-                data.resize(datalen);
-                for ( size_t i = 0; i != size; ++i )
+                data.resize(datalen*size);
+                for ( size_t j = 0; j != coll.size(); ++j )
                 {
-                    for ( size_t j = 0; j != coll.size(); ++j )
+                    for ( size_t i = 0; i != size; ++i )
                     {
-                        if ( vec_flag[j] )
-                            data[j] = coll[j][i];
-                        else
-                            data[j] = coll[j][0];
+                        data[j*size + i] = vec_flag[j] ? coll[j][i] : coll[j][0];
                     }
-                    r.push_back(f->value(data, bindID));
                 }
-                return r;
+                return plan.run(data, size);
             }
 
             template <typename... Args> inline std::vector<double> vect2(std::vector<std::vector<double>> & coll, double x, Args... argss)
@@ -492,6 +674,9 @@ namespace daFunk
 
             Funk f;  // bound function
 
+            // Flattened evaluation plan of f, compiled at bind time
+            FunkPlan plan;
+
             // datalen is the length of the double-valued data array that is
             // needed as workspace for function evaluation, and that is created
             // on the heap for each eval separately to ensure thread-safety.
@@ -594,6 +779,12 @@ namespace daFunk
                 return c;
             }
 
+            size_t compile(FunkPlan & plan, size_t bindID)
+            {
+                (void)bindID;
+                return plan.constant(c);
+            }
+
         private:
             double c;
     };
@@ -670,6 +861,18 @@ namespace daFunk
                 return functions[0]->value(data2, bindID);
             }
 
+            // Instead of copying the data, the slot is set in place for the
+            // evaluation of f and restored afterwards.
+            size_t compile(FunkPlan & plan, size_t bindID)
+            {
+                size_t g = functions[1]->compile(plan, bindID);
+                size_t saved = plan.load(my_index[bindID]);
+                plan.store(my_index[bindID], g);
+                size_t result = functions[0]->compile(plan, bindID);
+                plan.store(my_index[bindID], saved);
+                return result;
+            }
+
         private:
             std::string my_arg;
 
@@ -704,16 +907,14 @@ namespace daFunk
 
             double value(const std::vector<double> & data, size_t bindID)
             {
-                std::tuple<typename std::remove_reference<funcargs>::type...> my_input;
+                // Fixed arguments come from the (read-only) input tuple, function arguments
+                // are filled into a private copy, so that concurrent calls do not interfere.
+                std::tuple<typename std::remove_reference<funcargs>::type...> my_input = input;
                 double result;
                 size_t i = 0;
-                #pragma omp critical (FunkFunc_setInput)
+                for ( auto f = functions.begin(); f != functions.end(); ++f, ++i)
                 {
-                    for ( auto f = functions.begin(); f != functions.end(); ++f, ++i)
-                    {
-                        *map[i] = (*f)->value(data, bindID);
-                    }
-                    my_input = input;
+                    (*map[i])(my_input, (*f)->value(data, bindID));
                 }
                 if(threadsafe)
                 {
@@ -737,7 +938,7 @@ namespace daFunk
 
         private:
             std::tuple<typename std::remove_reference<funcargs>::type...> input;
-            std::vector<double*> map;
+            std::vector<void (*)(std::tuple<typename std::remove_reference<funcargs>::type...> &, double)> map;
             double (*ptr)(funcargs...);
 
             // Digest input parameters
@@ -754,13 +955,20 @@ namespace daFunk
             void digest_input(Funk f, Args... argss)
             {
                 const int i = sizeof...(funcargs) - sizeof...(argss) - 1;
-                map.push_back(&std::get<i>(input));
+                map.push_back(&set_input<i>);
                 arguments = joinArgs(arguments, f->getArgs());
                 functions.push_back(f);
                 singularities = joinSingl(singularities, f->getSingl());
                 digest_input(argss...);
             }
             void digest_input() {};
+
+            // Setter for the i-th function argument in a copy of the input tuple
+            template<int i>
+            static void set_input(std::tuple<typename std::remove_reference<funcargs>::type...> & my_input, double x)
+            {
+                std::get<i>(my_input) = x;
+            }
     };
 
     template <typename... funcargs, typename... Args>
@@ -794,16 +1002,14 @@ namespace daFunk
 
             double value(const std::vector<double> & data, size_t bindID)
             {
-                std::tuple<typename std::remove_reference<funcargs>::type...> my_input;
+                // Fixed arguments come from the (read-only) input tuple, function arguments
+                // are filled into a private copy, so that concurrent calls do not interfere.
+                std::tuple<typename std::remove_reference<funcargs>::type...> my_input = input;
                 double result;
                 size_t i = 0;
-                #pragma omp critical(FunkFuncM_value)
+                for ( auto f = functions.begin(); f != functions.end(); ++f, ++i)
                 {
-                    for ( auto f = functions.begin(); f != functions.end(); ++f, ++i)
-                    {
-                        *map[i] = (*f)->value(data, bindID);
-                    }
-                    my_input = input;
+                    (*map[i])(my_input, (*f)->value(data, bindID));
                 }
                 if(threadsafe)
                 {
@@ -827,7 +1033,7 @@ namespace daFunk
 
         private:
             std::tuple<typename std::remove_reference<funcargs>::type...> input;
-            std::vector<double*> map;
+            std::vector<void (*)(std::tuple<typename std::remove_reference<funcargs>::type...> &, double)> map;
             double (O::* ptr)(funcargs...);
             shared_ptr<O> shared_obj;
             O* obj;
@@ -846,13 +1052,20 @@ namespace daFunk
             void digest_input(Funk f, Args... argss)
             {
                 const int i = sizeof...(funcargs) - sizeof...(argss) - 1;
-                map.push_back(&std::get<i>(input));
+                map.push_back(&set_input<i>);
                 arguments = joinArgs(arguments, f->getArgs());
                 functions.push_back(f);
                 singularities = joinSingl(singularities, f->getSingl());
                 digest_input(argss...);
             }
             void digest_input() {};
+
+            // Setter for the i-th function argument in a copy of the input tuple
+            template<int i>
+            static void set_input(std::tuple<typename std::remove_reference<funcargs>::type...> & my_input, double x)
+            {
+                std::get<i>(my_input) = x;
+            }
     };
 
 
@@ -915,6 +1128,11 @@ namespace daFunk
             {
                 return data[indices[bindID][0]];
             }
+
+            size_t compile(FunkPlan & plan, size_t bindID)
+            {
+                return plan.load(indices[bindID][0]);
+            }
     };
     inline Funk var(std::string arg) { return Funk(new FunkVar(arg)); }
 
@@ -984,6 +1202,23 @@ namespace daFunk
 
     }
 
+    inline size_t FunkBase::compile(FunkPlan & plan, size_t bindID)
+    {
+        (void)bindID;
+        return plan.call(this);
+    }
+
+    inline void FunkPlan::compile(FunkBase * f, size_t datalen, size_t bindID)
+    {
+        code.clear();
+        subplans.clear();
+        nregs = 0;
+        branches = false;
+        this->datalen = datalen;
+        this->bindID = bindID;
+        result = f->compile(*this, bindID);
+    }
+
     template <typename... Args> inline bool FunkBase::assert_args(Args... args)
     {
         std::vector<std::vector<std::string>> list = vec<std::vector<std::string>>(args...);
@@ -1147,6 +1382,10 @@ namespace daFunk
             {
                 return -(functions[0]->value(data, bindID));
             }
+            size_t compile(FunkPlan & plan, size_t bindID)
+            {
+                return plan.neg(functions[0]->compile(plan, bindID));
+            }
     };
     inline Funk operator - (Funk f) { return Funk(new FunkMath_umin(f)); }
 
@@ -1165,6 +1404,11 @@ namespace daFunk
             {                                                                                             \
                 return OPERATION(functions[0]->value(data, bindID));                                      \
             }                                                                                             \
+            static double apply(double x) { return OPERATION(x); }                                        \
+            size_t compile(FunkPlan & plan, size_t bindID)                                                \
+            {                                                                                             \
+                return plan.unary(&apply, functions[0]->compile(plan, bindID));                           \
+            }                                                                                             \
     };                                                                                                    \
     inline Funk OPERATION (Funk f) { return Funk(new FunkMath_##OPERATION(f)); }
     MATH_OPERATION(cos)
@@ -1187,7 +1431,7 @@ namespace daFunk
 #undef MATH_OPERATION
 
     // Standard binary operations
-#define MATH_OPERATION(OPERATION, SYMBOL)                                                                 \
+#define MATH_OPERATION(OPERATION, SYMBOL, OPCODE)                                                         \
     class FunkMath_##OPERATION: public FunkBase                                                           \
     {                                                                                                     \
         public:                                                                                           \
@@ -1215,14 +1459,19 @@ namespace daFunk
             {                                                                                             \
                 return functions[0]->value(data, bindID) SYMBOL functions[1]->value(data, bindID);        \
             }                                                                                             \
+            size_t compile(FunkPlan & plan, size_t bindID)                                                \
+            {                                                                                             \
+                size_t a = functions[0]->compile(plan, bindID);                                           \
+                return plan.binary(FunkPlan::OPCODE, a, functions[1]->compile(plan, bindID));             \
+            }                                                                                             \
     };                                                                                                    \
     inline Funk operator SYMBOL (Funk f1, Funk f2) { return Funk(new FunkMath_##OPERATION(f1, f2)); }     \
     inline Funk operator SYMBOL (double x, Funk f) { return Funk(new FunkMath_##OPERATION(x, f)); }       \
     inline Funk operator SYMBOL (Funk f, double x) { return Funk(new FunkMath_##OPERATION(f, x)); }
-    MATH_OPERATION(Sum,+)
-    MATH_OPERATION(Mul,*)
-    MATH_OPERATION(Div,/)
-    MATH_OPERATION(Dif,-)
+    MATH_OPERATION(Sum,+,ADD)
+    MATH_OPERATION(Mul,*,MUL)
+    MATH_OPERATION(Div,/,DIV)
+    MATH_OPERATION(Dif,-,SUB)
 #undef MATH_OPERATION
 
     // More binary operations
@@ -1254,6 +1503,12 @@ namespace daFunk
             {                                                                                             \
                 return OPERATION(functions[0]->value(data, bindID), functions[1]->value(data, bindID));   \
             }                                                                                             \
+            static double apply(double x, double y) { return OPERATION(x, y); }                           \
+            size_t compile(FunkPlan & plan, size_t bindID)                                                \
+            {                                                                                             \
+                size_t a = functions[0]->compile(plan, bindID);                                           \
+                return plan.binary(&apply, a, functions[1]->compile(plan, bindID));                       \
+            }                                                                                             \
     };                                                                                                    \
     inline Funk OPERATION (Funk f1, Funk f2) { return Funk(new FunkMath_##OPERATION(f1, f2)); }           \
     inline Funk OPERATION (double x, Funk f) { return Funk(new FunkMath_##OPERATION(x, f)); }             \
@@ -1297,7 +1552,18 @@ namespace daFunk
             double value(const std::vector<double> & data, size_t bindID)
             {
                 functions[0]->value(data, bindID);
-                return (this->*ptr)(data[indices[bindID][0]]);
+                return (this->*ptr)(data[indices[bindID][0]], hint());
+            }
+
+            // Batch evaluation at many abscissae; sorted input walks the grid
+            // without any searching.
+            std::vector<double> value(const std::vector<double> & x)
+            {
+                std::vector<double> result(x.size());
+                size_t last = 1;
+                for ( size_t j = 0; j < x.size(); ++j )
+                    result[j] = (this->*ptr)(x[j], last);
+                return result;
             }
 
         private:
@@ -1309,39 +1575,65 @@ namespace daFunk
                 arguments = f->getArgs();
                 this->Xgrid = Xgrid;
                 this->Ygrid = Ygrid;
+                this->mode = mode;
                 if ( mode == "lin" ) this->ptr = &FunkInterp::linearInterp;
                 else if ( mode == "log" ) this->ptr = &FunkInterp::logInterp;
+
+                // Precompute the slope of every interval, in lin-lin or log-log space
+                slopes.assign(Xgrid.size(), 0.);
+                for ( size_t i = 1; i < Xgrid.size(); ++i )
+                {
+                    if ( mode == "log" )
+                        slopes[i] = std::log(Ygrid[i]/Ygrid[i-1]) / std::log(Xgrid[i]/Xgrid[i-1]);
+                    else
+                        slopes[i] = (Ygrid[i]-Ygrid[i-1]) / (Xgrid[i]-Xgrid[i-1]);
+                }
+            }
+
+            // Index i of the grid interval [Xgrid[i-1], Xgrid[i]) containing x
+            // (the last interval is closed).  The last result is tried first,
+            // then its right neighbour, and only then a binary search is done.
+            size_t bracket(double x, size_t & last) const
+            {
+                const size_t imax = Xgrid.size() - 1;
+                for ( size_t i = last; i <= last+1 and i <= imax; ++i )
+                {
+                    if ( i > 0 and Xgrid[i-1] <= x and (i == imax or x < Xgrid[i]) )
+                        return last = i;
+                }
+                return last = std::upper_bound(Xgrid.begin()+1, Xgrid.end()-1, x) - Xgrid.begin();
+            }
+
+            // Last bracketing interval of this object, one per thread.  Kept in a
+            // small per-thread table so that concurrent evaluations do not share it.
+            size_t & hint() const
+            {
+                static thread_local std::pair<const FunkInterp*, size_t> hints[16];
+                std::pair<const FunkInterp*, size_t> & h = hints[(reinterpret_cast<uintptr_t>(this) / sizeof(FunkInterp)) % 16];
+                if ( h.first != this ) h = std::make_pair(this, size_t(1));
+                return h.second;
             }
 
-            double logInterp(double x)
+            double logInterp(double x, size_t & last) const
             {
                 // Linear interpolation in log-log space
-                int i = 0; int imax = Xgrid.size() - 1;
-                if (x<Xgrid[0] or x>Xgrid[imax]) return 0;
-                for (; i < imax; i++) {if (Xgrid[i] > x) break;};
-                double x0 = Xgrid[i-1];
-                double x1 = Xgrid[i];
-                double y0 = Ygrid[i-1];
-                double y1 = Ygrid[i];
-                return y0 * std::exp(std::log(y1/y0) * std::log(x/x0) / std::log(x1/x0));
+                if (Xgrid.size() < 2 or x<Xgrid.front() or x>Xgrid.back()) return 0;
+                size_t i = bracket(x, last);
+                return Ygrid[i-1] * std::exp(slopes[i] * std::log(x/Xgrid[i-1]));
             }
 
-            double linearInterp(double x)
+            double linearInterp(double x, size_t & last) const
             {
                 // Linear interpolation in lin-lin space
-                int i = 0; int imax = Xgrid.size() - 1;
-                if (x<Xgrid[0] or x>Xgrid[imax]) return 0;
-                for (; i < imax; i++) {if (Xgrid[i] > x) break;};
-                double x0 = Xgrid[i-1];
-                double x1 = Xgrid[i];
-                double y0 = Ygrid[i-1];
-                double y1 = Ygrid[i];
-                return y0 + (x-x0)/(x1-x0)*(y1-y0);
+                if (Xgrid.size() < 2 or x<Xgrid.front() or x>Xgrid.back()) return 0;
+                size_t i = bracket(x, last);
+                return Ygrid[i-1] + (x-Xgrid[i-1])*slopes[i];
             }
 
-            double(FunkInterp::*ptr)(double);
+            double(FunkInterp::*ptr)(double, size_t &) const;
             std::vector<double> Xgrid;
             std::vector<double> Ygrid;
+            std::vector<double> slopes;
             std::string mode;
     };
     template <typename T> inline shared_ptr<FunkInterp> interp(T f, std::vector<double> x, std::vector<double> y) { return shared_ptr<FunkInterp>(new FunkInterp(f, x, y)); }
@@ -1367,6 +1659,17 @@ namespace daFunk
               else
                 return functions[2]->value(data,bindID);
             }
+            size_t compile(FunkPlan & plan, size_t bindID)
+            {
+              size_t out = plan.newRegister();
+              size_t to_else = plan.jump(FunkPlan::JUMP_UNLESS_NONNEG, functions[0]->compile(plan, bindID));
+              plan.move(out, functions[1]->compile(plan, bindID));
+              size_t to_end = plan.jump(FunkPlan::JUMP);
+              plan.land(to_else);
+              plan.move(out, functions[2]->compile(plan, bindID));
+              plan.land(to_end);
+              return out;
+            }
     };
     inline Funk ifelse(Funk f, Funk g, Funk h) { return Funk(new FunkIfElse(f, g, h)); }
     inline Funk ifelse(Funk f, double g, Funk h) { return Funk(new FunkIfElse(f, cnst(g), h)); }
@@ -1470,7 +1773,42 @@ namespace daFunk
     // GSL integration
     //
 
-    class FunkIntegrate_gsl1d: public FunkBase, public gsl_function
+    // Per-thread pool of GSL integration workspaces.  Integrations running
+    // concurrently on different threads, or nested on the same thread, each
+    // hold their own workspace for the duration of one value() call.
+    class FunkIntegrate_gsl1d_workspaces
+    {
+        public:
+            static const size_t size = 100000;
+
+            ~FunkIntegrate_gsl1d_workspaces()
+            {
+                for ( auto it = pool.begin(); it != pool.end(); ++it )
+                    gsl_integration_workspace_free(*it);
+            }
+
+            static gsl_integration_workspace * acquire()
+            {
+                std::vector<gsl_integration_workspace*> & free_list = local().pool;
+                if ( free_list.empty() ) return gsl_integration_workspace_alloc(size);
+                gsl_integration_workspace * w = free_list.back();
+                free_list.pop_back();
+                return w;
+            }
+
+            static void release(gsl_integration_workspace * w) { local().pool.push_back(w); }
+
+        private:
+            static FunkIntegrate_gsl1d_workspaces & local()
+            {
+                static thread_local FunkIntegrate_gsl1d_workspaces workspaces;
+                return workspaces;
+            }
+
+            std::vector<gsl_integration_workspace*> pool;
+    };
+
+    class FunkIntegrate_gsl1d: public FunkBase
     {
         public:
             FunkIntegrate_gsl1d(Funk f0, std::string arg, Funk f1, Funk f2)
@@ -1555,15 +1893,20 @@ namespace daFunk
                 }
             }
 
-            ~FunkIntegrate_gsl1d()
-            {
-                gsl_integration_workspace_free(gsl_workspace);
-            }
-
             shared_ptr<FunkIntegrate_gsl1d> set_epsrel(double epsrel)
             { this->epsrel = epsrel; return static_pointer_cast<FunkIntegrate_gsl1d>(this->FunkIntegrate_gsl1d::shared_from_this()); }
             shared_ptr<FunkIntegrate_gsl1d> set_epsabs(double epsabs)
             { this->epsabs = epsabs; return static_pointer_cast<FunkIntegrate_gsl1d>(this->shared_from_this()); }
+            // The integrand is compiled into a sub-plan owned by the outer
+            // plan (and so by the FunkBound holding this bindID), which is
+            // handed to value() by the CALL_SUB instruction and run by invoke().
+            size_t compile(FunkPlan & plan, size_t bindID)
+            {
+                FunkPlan & integrand = plan.subplan();
+                integrand.compile(&*functions[0], 0, bindID);
+                return plan.call(this, &FunkIntegrate_gsl1d::value_with_plan, integrand);
+            }
+
             shared_ptr<FunkIntegrate_gsl1d> set_limit(size_t limit)
             { this->limit = limit; return static_pointer_cast<FunkIntegrate_gsl1d>(this->shared_from_this()); }
             shared_ptr<FunkIntegrate_gsl1d> set_singularity_factor(double f)
@@ -1572,82 +1915,85 @@ namespace daFunk
             { this->use_log_fallback = flag; return static_pointer_cast<FunkIntegrate_gsl1d>(this->shared_from_this()); }
 
             double value(const std::vector<double> & data, size_t bindID)
+            {
+                return value(data, bindID, NULL);
+            }
+
+            // Integrate, evaluating the integrand with its compiled plan if one is given
+            double value(const std::vector<double> & data, size_t bindID, const FunkPlan * plan)
             {
                 double result;
-                #pragma omp critical(FunkIntegrate_gsl1d_integration)
+                // All evaluation state lives on the stack, so that integrals can run concurrently.
+                Workspace workspace;
+                Integrand integrand(this, data, bindID, plan);
+                gsl_function F;
+                F.function = &FunkIntegrate_gsl1d::invoke;
+                F.params = &integrand;
+                double error;
+                double x0 = functions[1]->value(data, bindID);
+                double x1 = functions[2]->value(data, bindID);
+                gsl_set_error_handler_off();
+                int status = 0;
+                if ( my_singularities.size() == 0 )
                 {
-                    local_data = data;
-                    local_bindID = bindID;
-                    double error;
-                    function=&FunkIntegrate_gsl1d::invoke;
-                    params=this;
-                    double x0 = functions[1]->value(data, bindID);
-                    double x1 = functions[2]->value(data, bindID);
-                    gsl_set_error_handler_off();
-                    int status = 0;
-                    if ( my_singularities.size() == 0 )
+                    status = gsl_integration_qags(&F, x0, x1, epsabs, epsrel, limit, workspace.w, &result, &error);
+                }
+                else
+                {
+                    double s = 0;
+                    std::vector<double> ranges;
+                    ranges.push_back(x0);
+                    ranges.push_back(x1);
+                    for ( auto it = my_singularities.begin(); it != my_singularities.end(); ++it )
                     {
-                        status = gsl_integration_qags(this, x0, x1, epsabs, epsrel, limit, gsl_workspace, &result, &error);
+                        double mean = it->first->value(data, bindID);
+                        double sigma = it->second->value(data, bindID);
+                        double z0 = mean - singl_factor*sigma;
+                        double z1 = mean + singl_factor*sigma;
+                        if ( z0 == z1 )
+                            std::cout << "daFunk::FunkBase WARNING: Singularity width is beyond machine precision." << std::endl;
+                        if ( z0 > x0 and z0 < x1 ) ranges.push_back(z0);
+                        if ( z1 > x0 and z1 < x1 ) ranges.push_back(z1);
                     }
-                    else
+                    std::sort(ranges.begin(), ranges.end());
+                    for ( auto it = ranges.begin(); it != ranges.end()-1; ++it )
                     {
-                        double s = 0;
-                        std::vector<double> ranges;
-                        ranges.push_back(x0);
-                        ranges.push_back(x1);
-                        for ( auto it = my_singularities.begin(); it != my_singularities.end(); ++it )
-                        {
-                            double mean = it->first->value(data, bindID);
-                            double sigma = it->second->value(data, bindID);
-                            double z0 = mean - singl_factor*sigma;
-                            double z1 = mean + singl_factor*sigma;
-                            if ( z0 == z1 )
-                                std::cout << "daFunk::FunkBase WARNING: Singularity width is beyond machine precision." << std::endl;
-                            if ( z0 > x0 and z0 < x1 ) ranges.push_back(z0);
-                            if ( z1 > x0 and z1 < x1 ) ranges.push_back(z1);
-                        }
-                        std::sort(ranges.begin(), ranges.end());
-                        for ( auto it = ranges.begin(); it != ranges.end()-1; ++it )
-                        {
-                            status = gsl_integration_qags(this, *it, *(it+1), epsabs, epsrel, limit, gsl_workspace, &result, &error);
-                            s += result;
-                            if (status) break;
-                        }
-                        result = s;
+                        status = gsl_integration_qags(&F, *it, *(it+1), epsabs, epsrel, limit, workspace.w, &result, &error);
+                        s += result;
+                        if (status) break;
                     }
-                    if (status and this->use_log_fallback)
+                    result = s;
+                }
+                if (status and this->use_log_fallback)
+                {
+                    // The last resort: A cheap integration on log grid, linear interpolation
+                    const double N = 300;
+                    std::vector<double> Xgrid = 
+                        logspace(std::log10(x0), std::log10(x1), N);
+                    double sum = 0, y0, y1, dx;
+                    y0 = invoke(Xgrid[0], &integrand);
+                    for (size_t i = 0; i<N-1; i++)
                     {
-                        // The last resort: A cheap integration on log grid, linear interpolation
-                        const double N = 300;
-                        std::vector<double> Xgrid = 
-                            logspace(std::log10(x0), std::log10(x1), N);
-                        double sum = 0, y0, y1, dx;
-                        local_data[index[bindID]] = Xgrid[0];
-                        y0 = functions[0]->value(local_data, bindID);
-                        for (size_t i = 0; i<N-1; i++)
-                        {
-                            local_data[index[bindID]] = Xgrid[i+1];
-                            y1 = functions[0]->value(local_data, bindID);
-                            dx = Xgrid[i+1]-Xgrid[i];
-                            sum += dx*(y0+y1)/2;
-                            y0 = y1;
-                        }
-                        result = sum;
+                        y1 = invoke(Xgrid[i+1], &integrand);
+                        dx = Xgrid[i+1]-Xgrid[i];
+                        sum += dx*(y0+y1)/2;
+                        y0 = y1;
                     }
-                    // TODO: Implement flags to optionally throw an error
-                    if (status and not this->use_log_fallback)
-                    {
-                        std::cerr << "daFunk::FunkIntegrate_gsl1d WARNING: " << gsl_strerror(status) << std::endl;
-                        std::cerr << "Attempt to integrate from " << x0 << " to " << x1 << std::endl;
-                        std::cerr << "Attempt to integrate from " << x0 << " to " << x1 << std::endl;
-                        std::cerr << "Details about the integrand:" << std::endl;
-                        functions[0]->help();
+                    result = sum;
+                }
+                // TODO: Implement flags to optionally throw an error
+                if (status and not this->use_log_fallback)
+                {
+                    std::cerr << "daFunk::FunkIntegrate_gsl1d WARNING: " << gsl_strerror(status) << std::endl;
+                    std::cerr << "Attempt to integrate from " << x0 << " to " << x1 << std::endl;
+                    std::cerr << "Attempt to integrate from " << x0 << " to " << x1 << std::endl;
+                    std::cerr << "Details about the integrand:" << std::endl;
+                    functions[0]->help();
 //                        std::cout << "Dumping integrand:" << std::endl;
 //                        for ( double x = x0; x <= x1; x = (x0>0) ? x*1.01 : x+(x1-x0)/1000)
-//                            std::cerr << "  " << x << " " << invoke(x, this) << std::endl;
-                        std::cerr << "Returning zero." << std::endl;
-                        result = 0.;
-                    }
+//                            std::cerr << "  " << x << " " << invoke(x, &integrand) << std::endl;
+                    std::cerr << "Returning zero." << std::endl;
+                    result = 0.;
                 }
                 return result;
             }
@@ -1665,7 +2011,6 @@ namespace daFunk
                 singularities = joinSingl(singularities, tmp_singl);
 
                 arguments = joinArgs(eraseArg(f0->getArgs(), arg), joinArgs(f1->getArgs(), f2->getArgs()));
-                gsl_workspace = gsl_integration_workspace_alloc (100000);
 
                 this->arg = arg;
                 limit = 100;
@@ -1675,23 +2020,49 @@ namespace daFunk
                 singl_factor = 4;
             }
 
+            // Evaluation state of one value() call: a private copy of the
+            // input data, with the integration variable rewired into it
+            struct Integrand
+            {
+                Integrand(FunkIntegrate_gsl1d * self, const std::vector<double> & data, size_t bindID, const FunkPlan * plan) :
+                    self(self), data(data), bindID(bindID), slot(self->index[bindID]), plan(plan) {}
+                FunkIntegrate_gsl1d * self;
+                std::vector<double> data;
+                size_t bindID;
+                size_t slot;
+                const FunkPlan * plan;  // Compiled integrand, or NULL
+            };
+
+            // Workspace borrowed from the per-thread pool for one value() call
+            struct Workspace
+            {
+                Workspace() : w(FunkIntegrate_gsl1d_workspaces::acquire()) {}
+                ~Workspace() { FunkIntegrate_gsl1d_workspaces::release(w); }
+                gsl_integration_workspace * w;
+            };
+
+            // Evaluator for the CALL_SUB instruction emitted by compile()
+            static double value_with_plan(FunkBase * f, const std::vector<double> & data, size_t bindID, const FunkPlan & integrand)
+            {
+                return static_cast<FunkIntegrate_gsl1d*>(f)->value(data, bindID, &integrand);
+            }
+
             // Static member function that invokes integrand
             static double invoke(double x, void *params) {
-                FunkIntegrate_gsl1d * ptr = static_cast<FunkIntegrate_gsl1d*>(params);
-                ptr->local_data[ptr->index[ptr->local_bindID]] = x;
-                return ptr->functions[0]->value(ptr->local_data, ptr->local_bindID);
+                Integrand * ptr = static_cast<Integrand*>(params);
+                ptr->data[ptr->slot] = x;
+                if ( ptr->plan != NULL and not ptr->plan->empty() )
+                    return ptr->plan->run(ptr->data);
+                return ptr->self->functions[0]->value(ptr->data, ptr->bindID);
             }
 
             // Required for rewiring input parameters
-            std::vector<double> local_data;
-            size_t local_bindID;
             std::vector<std::pair<Funk, Funk>> my_singularities;
 
             // Integration range and function pointer
             std::string arg;
 
-            // GSL workspace and parameters
-            gsl_integration_workspace * gsl_workspace;
+            // GSL parameters (workspaces come from FunkIntegrate_gsl1d_workspaces)
             size_t limit;
             std::vector<size_t> index;
             double epsrel;
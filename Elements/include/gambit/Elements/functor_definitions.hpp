@@ -102,6 +102,21 @@ namespace Gambit
       init_memory();                               // Init memory if this is the first run through.
       if (needs_recalculating[thread_num])         // Do the actual calculation if required.
       {
+        unsigned long long input = 0;
+        if (myMemoCapacity > 0)                    // Reuse a memoised result if the dependencies are unchanged.
+        {
+          input = inputFingerprint();
+          if (memo.retrieve(input, myValue[0]))
+          {
+            memo_hits++;
+            logger() << LogTags::debug << "Reusing memoised result of " << myOrigin << "::" << myName
+                     << " (" << memo_hits << " hits, " << memo_misses << " misses)." << EOM;
+            needs_recalculating[thread_num] = false;
+            myFingerprint[thread_num] = input;
+            return;
+          }
+          memo_misses++;
+        }
         logger().entering_module(myLogTag);
         this->startTiming(thread_num);             //Begin timing function evaluation
         try
@@ -118,10 +133,50 @@ namespace Gambit
           }
         }
         this->finishTiming(thread_num);            //Stop timing function evaluation
+        if (myMemoCapacity > 0 and not point_exception_raised) memo.store(input, myValue[0], myMemoCapacity);
         logger().leaving_module();
       }
     }
 
+    /// Setter for the number of results to memoise (0 = no memoisation)
+    template <typename TYPE>
+    void module_functor<TYPE>::setMemoisation(size_t capacity)
+    {
+      if (capacity > 0 and not memo_cache<TYPE>::enabled)
+      {
+        str warn_msg = "Cannot memoise results of function " + myName + " in " + myOrigin + ";\n"
+                       "its result type " + myType + " cannot be copied.";
+        utils_warning().raise(LOCAL_INFO,warn_msg);
+        return;
+      }
+      module_functor_common::setMemoisation(capacity);
+    }
+
+    /// Copy the memoised result for a given input fingerprint into value; false if there is none
+    template <typename TYPE, bool copyable>
+    bool memo_cache<TYPE, copyable>::retrieve(unsigned long long input, TYPE& value)
+    {
+      auto it = index.find(input);
+      if (it == index.end()) return false;
+      entries.splice(entries.begin(), entries, it->second);
+      value = entries.front().second;
+      return true;
+    }
+
+    /// Memoise a result for a given input fingerprint, evicting the least recently used beyond capacity
+    template <typename TYPE, bool copyable>
+    void memo_cache<TYPE, copyable>::store(unsigned long long input, const TYPE& value, size_t capacity)
+    {
+      if (index.find(input) != index.end()) return;
+      if (entries.size() >= capacity)
+      {
+        index.erase(entries.back().first);
+        entries.pop_back();
+      }
+      entries.push_front(std::make_pair(input, value));
+      index[input] = entries.begin();
+    }
+
     /// Initialise the memory of this functor.
     template <typename TYPE>
     void module_functor<TYPE>::init_memory()
@@ -39,8 +39,11 @@
 
 #include <map>
 #include <set>
+#include <list>
 #include <vector>
 #include <chrono>
+#include <unordered_map>
+#include <type_traits>
 #include <sstream>
 #include <algorithm>
 #include <omp.h>
@@ -179,6 +182,16 @@ namespace Gambit
       /// Setter for indicating if the timing data for this function's execution should be printed
       virtual void setTimingPrintRequirement(bool);
 
+      /// Setter for the number of results to memoise (0 = no memoisation)
+      virtual void setMemoisation(size_t);
+
+      /// Setter for declaring the wrapped function's result fully determined by its dependencies
+      virtual void setPure(bool);
+
+      /// Getter for a fingerprint of the current result of the wrapped function.  Two equal
+      /// fingerprints imply equal results; 0 means the result never changes.
+      virtual unsigned long long fingerprint(int index = 0);
+
       /// Set the ordered list of pointers to other functors that should run nested in a loop managed by this one
       virtual void setNestedList (std::vector<functor*>&);
 
@@ -401,6 +414,29 @@ namespace Gambit
       /// Getter indicating if the timing data for this function's execution should be printed
       bool requiresTimingPrinting() const;
 
+      /// Setter for the number of results to memoise (0 = no memoisation).
+      /// A memoising functor reuses a previous result whenever the fingerprints of all
+      /// its dependencies match those of that result.  Only switch this on for functions
+      /// whose result is fully determined by their dependencies (not by backend state,
+      /// random numbers, etc.), as backend requirements are not part of the fingerprint.
+      virtual void setMemoisation(size_t);
+
+      /// Setter for declaring the wrapped function's result fully determined by its
+      /// dependencies.  The result of a pure or memoised function is fingerprinted by its
+      /// inputs, so memoised functions downstream of it can still reuse their results when
+      /// it is recalculated from the same inputs.  All other results get a new fingerprint
+      /// every time they are calculated.
+      virtual void setPure(bool);
+
+      /// Getter for a fingerprint of the current result of the wrapped function
+      unsigned long long fingerprint(int index = 0);
+
+      /// Getters for memoisation statistics
+      /// @{
+      long long getMemoisationHits() const;
+      long long getMemoisationMisses() const;
+      /// @}
+
       /// Indicate whether or not a known model is activated or not.
       bool getActiveModelFlag(str);
 
@@ -546,9 +582,30 @@ namespace Gambit
       /// Do post-calculate timing things
       virtual void finishTiming(int);
 
+      /// Combined fingerprint of the current results of all dependencies
+      unsigned long long inputFingerprint();
+
+      /// Return a new fingerprint, different from all earlier ones
+      static unsigned long long freshFingerprint();
+
       /// Flag to select whether or not the timing data for this function's execution should be printed;
       bool myTimingPrintFlag;
 
+      /// Maximum number of results to memoise (0 = no memoisation)
+      size_t myMemoCapacity;
+
+      /// Flag indicating that the result is fully determined by the dependencies
+      bool myPureFlag;
+
+      /// Memoisation hit and miss counters
+      long long memo_hits, memo_misses;
+
+      /// Fingerprints of the current results
+      unsigned long long* myFingerprint;
+
+      /// Functors that this one depends on
+      std::vector<functor*> myDependencyFunctors;
+
       /// Initialise the memory of this functor.
       virtual void init_memory();
 
@@ -693,6 +750,51 @@ namespace Gambit
   };
 
 
+  /// Store of memoised module function results, indexed by the fingerprints of the inputs they were
+  /// calculated from.  Results can only be memoised if they can be copied; the specialisation below
+  /// for other types does nothing, so that module_functor<TYPE> never requires TYPE to be copyable.
+  template <typename TYPE, bool copyable = std::is_copy_constructible<TYPE>::value and std::is_copy_assignable<TYPE>::value>
+  class memo_cache
+  {
+
+    public:
+
+      /// Whether results of this type can be memoised
+      static const bool enabled = true;
+
+      /// Copy the result for a given input fingerprint into value; false if there is none
+      bool retrieve(unsigned long long input, TYPE& value);
+
+      /// Store a copy of the result for a given input fingerprint, evicting the least recently used beyond capacity
+      void store(unsigned long long input, const TYPE& value, size_t capacity);
+
+    private:
+
+      /// Memoised results, most recently used first, and their index by input fingerprint
+      std::list<std::pair<unsigned long long, TYPE> > entries;
+      std::unordered_map<unsigned long long, typename std::list<std::pair<unsigned long long, TYPE> >::iterator> index;
+
+  };
+
+  /// Store of memoised module function results, for types that cannot be copied (and so are never memoised)
+  template <typename TYPE>
+  class memo_cache<TYPE, false>
+  {
+
+    public:
+
+      /// Whether results of this type can be memoised
+      static const bool enabled = false;
+
+      /// There is never a memoised result to copy
+      bool retrieve(unsigned long long, TYPE&) { return false; }
+
+      /// Nothing can be stored
+      void store(unsigned long long, const TYPE&, size_t) {}
+
+  };
+
+
   /// Actual module functor type for all but TYPE=void
   template <typename TYPE>
   class module_functor : public module_functor_common
@@ -715,6 +817,9 @@ namespace Gambit
       /// Calculate method
       void calculate();
 
+      /// Setter for the number of results to memoise (0 = no memoisation)
+      void setMemoisation(size_t);
+
       /// Operation (return value)
       const TYPE& operator()(int index);
 
@@ -741,6 +846,9 @@ namespace Gambit
       /// Flag to select whether or not the results of this functor should be sent to the printer object.
       bool myPrintFlag;
 
+      /// Memoised results
+      memo_cache<TYPE> memo;
+
       /// Initialise the memory of this functor.
       virtual void init_memory();
 
@@ -944,6 +1052,9 @@ namespace Gambit
       /// Function for handing over parameter identities to another model_functor
       void donateParameters(model_functor &receiver);
 
+      /// Fingerprint of the current parameter values
+      unsigned long long fingerprint(int index = 0);
+
   };
 
 
@@ -49,8 +49,8 @@ namespace Gambit {
       else if(check_overrides == ignore_overrides){overrides=false; override_only=false;}
       
       /* Create finder object, tell it what maps to search, and do the search */
-      const OverrideMaps         overridecoll = override_maps.at(partype);
-      const MapCollection<MTget> mapcoll      = getter_maps.at(partype);
+      const OverrideMaps&         overridecoll = override_maps.at(partype);
+      const MapCollection<MTget>& mapcoll      = getter_maps.at(partype);
       FptrFinder<Spec<DerivedSpec>,MapTag::Get> finder =                                
                        SetMaps<Spec<DerivedSpec>,MapTag::Get>(Par::toString.at(partype),this)
                               .omap0(  overridecoll.m0 ) 
@@ -80,8 +80,8 @@ namespace Gambit {
       else if(check_overrides == ignore_overrides){overrides=false; override_only=false;}
   
      /* Create finder object, tell it what maps to search, and do the search */
-      const OverrideMaps         overridecoll = override_maps.at(partype);
-      const MapCollection<MTget> mapcoll      = getter_maps.at(partype);
+      const OverrideMaps&         overridecoll = override_maps.at(partype);
+      const MapCollection<MTget>& mapcoll      = getter_maps.at(partype);
       FptrFinder<Spec<DerivedSpec>,MapTag::Get> finder =                                
                        SetMaps<Spec<DerivedSpec>,MapTag::Get>(Par::toString.at(partype),this)
                               .omap0(  overridecoll.m0 ) 
@@ -109,7 +109,7 @@ namespace Gambit {
       /* Before trying to set parameter, check if there is an override defined
          for it, so that we can warn people that the value they are trying to
          set will be masked by the override */
-      const OverrideMaps overridecoll = override_maps.at(partype);
+      const OverrideMaps& overridecoll = override_maps.at(partype);
       FptrFinder<Spec<DerivedSpec>,MapTag::Set> override_finder =                                
                        SetMaps<Spec<DerivedSpec>,MapTag::Set>(Par::toString.at(partype),this)
                               .omap0( overridecoll.m0 ) 
@@ -125,7 +125,7 @@ namespace Gambit {
       // else no problem
 
       /* Create finder object, tell it what maps to search, and do the search */
-      const MapCollection<MTset> mapcoll = setter_maps.at(partype);
+      const MapCollection<MTset>& mapcoll = setter_maps.at(partype);
       FptrFinder<Spec<DerivedSpec>,MapTag::Set> finder =                                
                        SetMaps<Spec<DerivedSpec>,MapTag::Set>(Par::toString.at(partype),this)
                               .map0(  mapcoll.map0 )       
@@ -153,8 +153,8 @@ namespace Gambit {
       else if(check_overrides == ignore_overrides){overrides=false; override_only=false;}
  
       /* Create finder object, tell it what maps to search, and do the search */
-      const OverrideMaps         overridecoll = override_maps.at(partype);
-      const MapCollection<MTget> mapcoll      = getter_maps.at(partype);
+      const OverrideMaps&         overridecoll = override_maps.at(partype);
+      const MapCollection<MTget>& mapcoll      = getter_maps.at(partype);
       FptrFinder<Spec<DerivedSpec>,MapTag::Get> finder =                                
                        SetMaps<Spec<DerivedSpec>,MapTag::Get>(Par::toString.at(partype),this)
                               .omap0( overridecoll.m0 ) 
@@ -184,8 +184,8 @@ namespace Gambit {
       else if(check_overrides == ignore_overrides){overrides=false; override_only=false;}
  
       /* Create finder object, tell it what maps to search, and do the search */
-      const OverrideMaps         overridecoll = override_maps.at(partype);
-      const MapCollection<MTget> mapcoll      = getter_maps.at(partype);
+      const OverrideMaps&         overridecoll = override_maps.at(partype);
+      const MapCollection<MTget>& mapcoll      = getter_maps.at(partype);
       FptrFinder<Spec<DerivedSpec>,MapTag::Get> finder =                                
                        SetMaps<Spec<DerivedSpec>,MapTag::Get>(Par::toString.at(partype),this)
                               .omap0( overridecoll.m0 ) 
@@ -213,7 +213,7 @@ namespace Gambit {
       /* Before trying to set parameter, check if there is an override defined
          for it, so that we can warn people that the value they are trying to
          set will be masked by the override */
-      const OverrideMaps overridecoll = override_maps.at(partype);
+      const OverrideMaps& overridecoll = override_maps.at(partype);
       FptrFinder<Spec<DerivedSpec>,MapTag::Set> override_finder =                                
                        SetMaps<Spec<DerivedSpec>,MapTag::Set>(Par::toString.at(partype),this)
                               .omap0( overridecoll.m0 ) 
@@ -229,7 +229,7 @@ namespace Gambit {
       // else no problem
 
       /* Create finder object, tell it what maps to search, and do the search */
-      const MapCollection<MTset> mapcoll = setter_maps.at(partype);
+      const MapCollection<MTset>& mapcoll = setter_maps.at(partype);
       FptrFinder<Spec<DerivedSpec>,MapTag::Set> finder =                                
                        SetMaps<Spec<DerivedSpec>,MapTag::Set>(Par::toString.at(partype),this)
                               .map0(  mapcoll.map0 )       
@@ -259,8 +259,8 @@ namespace Gambit {
       else if(check_overrides == ignore_overrides){overrides=false; override_only=false;}
  
       /* Create finder object, tell it what maps to search, and do the search */
-      const OverrideMaps         overridecoll = override_maps.at(partype);
-      const MapCollection<MTget> mapcoll      = getter_maps.at(partype);
+      const OverrideMaps&         overridecoll = override_maps.at(partype);
+      const MapCollection<MTget>& mapcoll      = getter_maps.at(partype);
       FptrFinder<Spec<DerivedSpec>,MapTag::Get> finder =                                
                        SetMaps<Spec<DerivedSpec>,MapTag::Get>(Par::toString.at(partype),this)
                               .omap2( overridecoll.m2 )
@@ -285,8 +285,8 @@ namespace Gambit {
       else if(check_overrides == ignore_overrides){overrides=false; override_only=false;}
  
       /* Create finder object, tell it what maps to search, and do the search */
-      const OverrideMaps         overridecoll = override_maps.at(partype);
-      const MapCollection<MTget> mapcoll      = getter_maps.at(partype);
+      const OverrideMaps&         overridecoll = override_maps.at(partype);
+      const MapCollection<MTget>& mapcoll      = getter_maps.at(partype);
       FptrFinder<Spec<DerivedSpec>,MapTag::Get> finder =                                
                        SetMaps<Spec<DerivedSpec>,MapTag::Get>(Par::toString.at(partype),this)
                               .omap2( overridecoll.m2 )
@@ -307,7 +307,7 @@ namespace Gambit {
       typedef typename DerivedSpec::MTset MTset;
 
       /* Create finder object, tell it what maps to search, and do the search */
-      const MapCollection<MTset> mapcoll = setter_maps.at(partype);
+      const MapCollection<MTset>& mapcoll = setter_maps.at(partype);
       FptrFinder<Spec<DerivedSpec>,MapTag::Set> finder =                                
                        SetMaps<Spec<DerivedSpec>,MapTag::Set>(Par::toString.at(partype),this)
                               .map2(  mapcoll.map2 )
@@ -320,6 +320,38 @@ namespace Gambit {
 
    /// @}
 
+   /// @{ Pre-resolved getters
+
+   template <class DerivedSpec>
+   std::shared_ptr<const SpecGetter> Spec<DerivedSpec>::resolve_getter(const Par::Tags partype, const str& name, const int i, const int j, const int nindices, const SafeBool check_antiparticle) const
+   {
+      /* Search only the wrapper maps; overrides are checked by the handle itself */
+      const MapCollection<MTget>& mapcoll = getter_maps.at(partype);
+      FptrFinder<Spec<DerivedSpec>,MapTag::Get> finder =
+                       SetMaps<Spec<DerivedSpec>,MapTag::Get>(Par::toString.at(partype),this)
+                              .map0(  mapcoll.map0 )
+                              .map1(  mapcoll.map1 )
+                              .map2(  mapcoll.map2 )
+                              .map0W( mapcoll.map0W )
+                              .map1W( mapcoll.map1W )
+                              .map2W( mapcoll.map2W )
+                              .map0M( mapcoll.map0_extraM )
+                              .map1M( mapcoll.map1_extraM )
+                              .map2M( mapcoll.map2_extraM )
+                              .map0I( mapcoll.map0_extraI )
+                              .map1I( mapcoll.map1_extraI )
+                              .map2I( mapcoll.map2_extraI )
+                              .no_overrides(true);
+      bool found;
+      if     (nindices==0) found = finder.find(name,true,check_antiparticle);
+      else if(nindices==1) found = finder.find(name,i,true,check_antiparticle);
+      else                 found = finder.find(name,i,j);
+      if(not found) return std::shared_ptr<const SpecGetter>();
+      return std::make_shared<const ResolvedGetter<Spec<DerivedSpec>>>(finder);
+   }
+
+   /// @}
+
    /// @}
 
 }
@@ -146,6 +146,10 @@ namespace Gambit {
    template<class HostSpec, class MTag>
    struct CallFcn;
 
+   /// Getter found by FptrFinder, detached from the finder for repeated use
+   template<class HostSpec>
+   class ResolvedGetter;
+
    /// Helper class for locating the function pointer corresponding to a 
    /// requested string, from amongst the various different maps in which
    /// it could be located.
@@ -153,6 +157,7 @@ namespace Gambit {
    class FptrFinder
    {
       friend struct CallFcn<HostSpec,MTag>;
+      friend class ResolvedGetter<HostSpec>;
   
       private:
          /// Label to help track down errors if they occur
@@ -912,6 +917,76 @@ namespace Gambit {
       }
    };
 
+   /// Getter function located by a (successful, override-free) FptrFinder search, detached
+   /// from the finder so that it can be stored in a SpecParHandle and called repeatedly on
+   /// any SubSpectrum of the same wrapper type without repeating the search.  The function
+   /// pointer maps are static, so the stored iterators remain valid indefinitely.
+   template<class HostSpec>
+   class ResolvedGetter : public SpecGetter
+   {
+     private:
+      typedef typename HostSpec::D DerivedSpec;
+      typedef typename SpecTraits<DerivedSpec>::Model Model;
+      typedef typename SpecTraits<DerivedSpec>::Input Input;
+      typedef MapTypes<DerivedSpec,MapTag::Get> MT;
+      typedef FptrFinder<HostSpec,MapTag::Get> FF;
+
+      const int whichiter;
+      const int index1;
+      const int index2;
+      const typename MT::fmap0::const_iterator        it0;
+      const typename MT::fmap1::const_iterator        it1;
+      const typename MT::fmap2::const_iterator        it2;
+      const typename MT::fmap0W::const_iterator       it0W;
+      const typename MT::fmap1W::const_iterator       it1W;
+      const typename MT::fmap2W::const_iterator       it2W;
+      const typename MT::fmap0_extraM::const_iterator it0M;
+      const typename MT::fmap1_extraM::const_iterator it1M;
+      const typename MT::fmap2_extraM::const_iterator it2M;
+      const typename MT::fmap0_extraI::const_iterator it0I;
+      const typename MT::fmap1_extraI::const_iterator it1I;
+      const typename MT::fmap2_extraI::const_iterator it2I;
+
+     public:
+      ResolvedGetter(const FF& ff)
+        : whichiter(ff.whichiter), index1(ff.index1), index2(ff.index2)
+        , it0(ff.it0), it1(ff.it1), it2(ff.it2)
+        , it0W(ff.it0W), it1W(ff.it1W), it2W(ff.it2W)
+        , it0M(ff.it0M), it1M(ff.it1M), it2M(ff.it2M)
+        , it0I(ff.it0I), it1I(ff.it1I), it2I(ff.it2I)
+      {
+         if(ff.error_code!=0 or whichiter<3 or whichiter>14)
+         {
+           std::ostringstream errmsg;
+           errmsg << "Error! Tried to detach a getter from an FptrFinder that did not find one in the wrapper maps (error code "<<ff.error_code<<", whichiter "<<whichiter<<"). This indicates a bug in the Spec class. Please report it.";
+           utils_error().forced_throw(LOCAL_INFO,errmsg.str());
+         }
+      }
+
+      double operator()(const SubSpectrum& spec) const
+      {
+         const HostSpec& host = static_cast<const HostSpec&>(spec);
+         const Model& model = host.model();
+         const Input& input = host.input();
+         const DerivedSpec* wrapper = static_cast<const DerivedSpec*>(&host);
+         switch(whichiter)
+         {
+            case 3:  return (model.*(it0->second))();
+            case 4:  return (*(it0M->second))(model);
+            case 5:  return (*(it0I->second))(input);
+            case 6:  return (model.*(it1->second.fptr))(index1);
+            case 7:  return (*(it1M->second.fptr))(model,index1);
+            case 8:  return (*(it1I->second.fptr))(input,index1);
+            case 9:  return (model.*(it2->second.fptr))(index1,index2);
+            case 10: return (*(it2M->second.fptr))(model,index1,index2);
+            case 11: return (*(it2I->second.fptr))(input,index1,index2);
+            case 12: return (wrapper->*(it0W->second))();
+            case 13: return (wrapper->*(it1W->second.fptr))(index1);
+            default: return (wrapper->*(it2W->second.fptr))(index1,index2);
+         }
+      }
+   };
+
    /// Specialisation of CallFcn for calling 'setter' functions
    template<class HostSpec>
    struct CallFcn<HostSpec,MapTag::Set>
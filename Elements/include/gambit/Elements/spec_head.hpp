@@ -118,6 +118,9 @@ namespace Gambit
          double get(const Par::Tags, const str&, const int, const SpecOverrideOptions=use_overrides, const SafeBool=SafeBool(true)) const;
          bool   has(const Par::Tags, const str&, const int, const int, const SpecOverrideOptions=use_overrides) const;
          double get(const Par::Tags, const str&, const int, const int, const SpecOverrideOptions=use_overrides) const;
+         /* Don't hide the non-virtual base class overloads (PDG codes, pre-resolved handles) */
+         using SubSpectrum::has;
+         using SubSpectrum::get;
 
          /* Setter declarations, for setting parameters in a derived model object,
             and for overriding model object values with values stored outside
@@ -128,6 +131,15 @@ namespace Gambit
          void set(const Par::Tags, const double, const str&, const int, const SafeBool=SafeBool(true));
          void set(const Par::Tags, const double, const str&, const int, const int);
 
+     protected:
+         /// Resolve a getter from the wrapper maps, for use in a SpecParHandle
+         std::shared_ptr<const SpecGetter> resolve_getter(const Par::Tags, const str&, const int, const int, const int, const SafeBool) const;
+
+         /// Handles resolved for one wrapper type can be used with any other object of that type
+         const void* getter_domain() const { return &getter_maps; }
+
+     public:
+
          /// @{ Default (empty) map filler functions
          /// Override as needed in derived classes
          static const std::map<Par::Tags,MapCollection<MTget>> fill_getter_maps()
@@ -107,6 +107,15 @@ namespace Gambit
 {
 
    /// "Standard Model" (low-energy) plus high-energy model container class
+   /// Handle for the Spectrum "shortcut" getters, holding one pre-resolved handle for each hosted SubSpectrum
+   struct SpectrumParHandle
+   {
+      SpecParHandle HE;
+      SpecParHandle LE;
+      /// Description of the parameter, for error messages
+      str label;
+   };
+
    class Spectrum
    {
       /// Friend function: swap resources of two Spectrum objects
@@ -213,6 +222,15 @@ namespace Gambit
          double get(const Par::Tags partype, const std::pair<str,int> shortpr) const;
          /// @}
 
+         /// @{ Pre-resolved handles for the above getters
+         /// Resolve once with get_handle, then retrieve with get(handle) without any string lookups.
+         SpectrumParHandle get_handle(const Par::Tags partype, const std::string& mass) const;
+         SpectrumParHandle get_handle(const Par::Tags partype, const std::string& mass, const int index) const;
+         SpectrumParHandle get_handle(const Par::Tags partype, const std::pair<int,int> pdgpr) const;
+         bool   has(const SpectrumParHandle&) const;
+         double get(const SpectrumParHandle&) const;
+         /// @}
+
          /// @{ Getters which first check the sanity of the thing they are returning
          double safeget(const Par::Tags partype, const std::string& mass) const;
          double safeget(const Par::Tags partype, const std::string& mass, const int index) const;
@@ -28,6 +28,8 @@
 
 #include <map>
 #include <set>
+#include <memory>
+#include <vector>
 #include <cfloat>
 #include <sstream>
 
@@ -79,6 +81,66 @@ namespace Gambit
       /* e.g. retrieve like this: contents = m2[name][i][j]; */
    };
 
+   /// Base class for getter functions pre-resolved from the function pointer maps of a wrapper
+   struct SpecGetter
+   {
+      virtual ~SpecGetter() {}
+      /// Call the getter on a SubSpectrum of the wrapper type that it was resolved for
+      virtual double operator()(const SubSpectrum&) const = 0;
+   };
+
+   /// Handle to a single spectrum parameter, resolved once by SubSpectrum::get_handle and
+   /// then retrieved by SubSpectrum::get without any string lookups.
+   /// A handle can be used with any SubSpectrum object.  It re-resolves itself if used with a
+   /// different wrapper type, and re-checks the override maps only when they have changed.
+   /// Handles cache this state internally, so a single handle should not be shared between threads.
+   class SpecParHandle
+   {
+      public:
+         SpecParHandle()
+          : partype(), name(), i(-1), j(-1), nindices(-1)
+          , check_overrides(use_overrides), check_antiparticle(true)
+          , getter_domain(NULL), stamp(0), override_value(NULL)
+         {}
+
+         /// Has the handle been resolved?
+         bool resolved() const { return nindices >= 0; }
+
+      private:
+         friend class SubSpectrum;
+
+         /// An entry in the override maps that could hide the parameter
+         struct OverrideKey
+         {
+            int nindices;
+            str name;
+            int i;
+            int j;
+         };
+
+         /// The request that the handle was resolved from
+         Par::Tags partype;
+         str name;
+         int i;
+         int j;
+         int nindices;
+         SpecOverrideOptions check_overrides;
+         bool check_antiparticle;
+
+         /// Override map entries to check, in the order that the string-based getters search them
+         std::vector<OverrideKey> override_keys;
+
+         /// Getter resolved from the wrapper maps (NULL if the wrapper does not provide the parameter)
+         mutable std::shared_ptr<const SpecGetter> getter;
+         /// Wrapper type that the getter was resolved for
+         mutable const void* getter_domain;
+
+         /// Override stamp of the SubSpectrum that override_value was looked up in
+         mutable unsigned long long stamp;
+         /// Matching override value (NULL if none)
+         mutable const double* override_value;
+   };
+
 
 
    /// Virtual base class for interacting with spectrum generator output
@@ -89,7 +151,16 @@ namespace Gambit
 
       public:
          /// @{ Constructors/destructors
-         SubSpectrum() : override_maps(create_override_maps()) {}
+         SubSpectrum() : override_maps(create_override_maps()), override_stamp(new_override_stamp()) {}
+         /// Copies get their own override stamp, as handles may point into their override maps.
+         SubSpectrum(const SubSpectrum& other) : override_maps(other.override_maps), override_stamp(new_override_stamp()) {}
+         /// Likewise on assignment, as the assigned-to object's override maps change.
+         SubSpectrum& operator=(const SubSpectrum& other)
+         {
+            override_maps = other.override_maps;
+            override_stamp = new_override_stamp();
+            return *this;
+         }
          virtual ~SubSpectrum() {}
          /// @}
 
@@ -252,10 +323,41 @@ namespace Gambit
 
          /// TODO: extra PDB overloads to handle all the one and two index cases (well all the ones that are feasible...)
 
+         /* Pre-resolved parameter handles. Resolve a parameter once with get_handle, then retrieve it
+            (from this or any other SubSpectrum object) with get(handle). Lookups give the same results
+            as the corresponding string-based getters, including overrides set after the handle was made. */
+         SpecParHandle get_handle(const Par::Tags, const str&,
+              const SpecOverrideOptions=use_overrides,
+              const SafeBool check_antiparticle = SafeBool(true)) const;
+
+         SpecParHandle get_handle(const Par::Tags, const str&, const int,
+              const SpecOverrideOptions=use_overrides,
+              const SafeBool check_antiparticle = SafeBool(true)) const;
+
+         SpecParHandle get_handle(const Par::Tags, const str&, const int, const int,
+              const SpecOverrideOptions=use_overrides) const;
+
+         SpecParHandle get_handle(const Par::Tags, const std::pair<int,int>,
+              const SpecOverrideOptions=use_overrides,
+              const SafeBool check_antiparticle = SafeBool(true)) const; /* Input PDG code plus context integer */
+
+         bool   has(const SpecParHandle&) const;
+         double get(const SpecParHandle&) const;
+
 
          /// PDG code translation map, for special cases where an SLHA file has been read in and the PDG codes changed.
          virtual const std::map<int, int>& PDG_translator() const { return empty_map; }
 
+     protected:
+
+         /// Resolve a getter for a parameter from the function pointer maps of the wrapper, ignoring
+         /// overrides.  Returns NULL if the parameter is not found. Overridden by Spec<DerivedSpec>.
+         virtual std::shared_ptr<const SpecGetter> resolve_getter(const Par::Tags, const str&, const int, const int,
+          const int /*nindices*/, const SafeBool /*check_antiparticle*/) const { return std::shared_ptr<const SpecGetter>(); }
+
+         /// Identifies the wrapper type, so that handles can tell whether their getter applies to this object.
+         virtual const void* getter_domain() const { return NULL; }
+
      private:
 
          const std::map<int, int> empty_map;
@@ -263,10 +365,25 @@ namespace Gambit
          /// Initialiser function for override_maps
          static std::map<Par::Tags,OverrideMaps> create_override_maps();
 
+         /// Generate a new, globally unique override stamp
+         static unsigned long long new_override_stamp();
+
+         /// Refresh the override value cached in a handle, if the override maps have changed since
+         const double* find_override(const SpecParHandle&) const;
+
+         /// Fill in a handle with the override entries that could hide a parameter
+         void fill_override_keys(SpecParHandle&) const;
+
+         /// Retrieve the parameter described by a handle using the string-based getters
+         double get_by_name(const SpecParHandle&) const;
+
      protected:
          /// Map of override maps
          std::map<Par::Tags,OverrideMaps> override_maps;
 
+         /// Stamp identifying the current contents of override_maps; renewed whenever they change
+         unsigned long long override_stamp;
+
    };
 
 } // end namespace Gambit
@@ -35,6 +35,8 @@
 ///  *********************************************
 
 #include <chrono>
+#include <atomic>
+#include <cstring>
 
 #include "gambit/Elements/functors.hpp"
 #include "gambit/Elements/functor_definitions.hpp"
@@ -167,6 +169,27 @@ namespace Gambit
       }
     }
 
+    /// Setter for the number of results to memoise
+    void functor::setMemoisation(size_t capacity)
+    {
+      if (capacity > 0)
+      {
+        utils_error().raise(LOCAL_INFO,"The setMemoisation method has not been defined in this class.");
+      }
+    }
+
+    /// Setter for declaring the wrapped function's result fully determined by its dependencies
+    void functor::setPure(bool flag)
+    {
+      if (flag)
+      {
+        utils_error().raise(LOCAL_INFO,"The setPure method has not been defined in this class.");
+      }
+    }
+
+    /// Getter for a fingerprint of the current result (constant by default)
+    unsigned long long functor::fingerprint(int) { return 0; }
+
     /// Set the ordered list of pointers to other functors that should run nested in a loop managed by this one
     void functor::setNestedList (std::vector<functor*>&)
     {
@@ -578,6 +601,21 @@ namespace Gambit
     invalid_point_exception* functor::retrieve_invalid_point_exception() { return NULL; }
 
 
+    /// Mix the bits of a 64-bit integer (splitmix64 finaliser)
+    static unsigned long long mix_fingerprint(unsigned long long x)
+    {
+      x ^= x >> 30; x *= 0xbf58476d1ce4e5b9ULL;
+      x ^= x >> 27; x *= 0x94d049bb133111ebULL;
+      x ^= x >> 31;
+      return x;
+    }
+
+    /// Fold a value into a running fingerprint
+    static unsigned long long combine_fingerprint(unsigned long long seed, unsigned long long x)
+    {
+      return mix_fingerprint(seed ^ (x + 0x9e3779b97f4a7c15ULL + (seed << 6) + (seed >> 2)));
+    }
+
     // Module_functor_common class methods
 
     /// Constructor
@@ -588,6 +626,11 @@ namespace Gambit
                                                  Models::ModelFunctorClaw &claw)
     : functor                  (func_name, func_capability, result_type, origin_name, claw),
       myTimingPrintFlag        (false),
+      myMemoCapacity           (0),
+      myPureFlag               (false),
+      memo_hits                (0),
+      memo_misses              (0),
+      myFingerprint            (NULL),
       start                    (NULL),
       end                      (NULL),
       point_exception_raised   (false),
@@ -620,6 +663,7 @@ namespace Gambit
       if (already_printed != NULL)        delete [] already_printed;
       if (already_printed_timing != NULL) delete [] already_printed_timing;
       if (myCurrentIteration != NULL)     delete [] myCurrentIteration;
+      if (myFingerprint != NULL)          delete [] myFingerprint;
     }
 
     /// Check if an appropriate LogTag for this functor is missing from the logging system.
@@ -654,6 +698,63 @@ namespace Gambit
       return myTimingPrintFlag;
     }
 
+    /// Setter for the number of results to memoise (0 = no memoisation)
+    void module_functor_common::setMemoisation(size_t capacity)
+    {
+      if (capacity > 0 and (iRunNested or iCanManageLoops or myType == "void"))
+      {
+        str warn_msg = "Cannot memoise results of function " + myName + " in " + myOrigin + ";\n"
+                       "only functions that have a result and neither run in nor manage a loop can be memoised.";
+        utils_warning().raise(LOCAL_INFO,warn_msg);
+        return;
+      }
+      myMemoCapacity = capacity;
+    }
+
+    /// Setter for declaring the wrapped function's result fully determined by its dependencies
+    void module_functor_common::setPure(bool flag)
+    {
+      if (flag and (iRunNested or iCanManageLoops))
+      {
+        str warn_msg = "Cannot declare function " + myName + " in " + myOrigin + " pure;\n"
+                       "the results of functions that run in or manage a loop depend on the loop iteration.";
+        utils_warning().raise(LOCAL_INFO,warn_msg);
+        return;
+      }
+      myPureFlag = flag;
+    }
+
+    /// Getter for a fingerprint of the current result of the wrapped function
+    unsigned long long module_functor_common::fingerprint(int index)
+    {
+      init_memory();
+      return myFingerprint[iRunNested ? index : 0];
+    }
+
+    /// Getters for memoisation statistics
+    /// @{
+    long long module_functor_common::getMemoisationHits() const { return memo_hits; }
+    long long module_functor_common::getMemoisationMisses() const { return memo_misses; }
+    /// @}
+
+    /// Combined fingerprint of the current results of all dependencies
+    unsigned long long module_functor_common::inputFingerprint()
+    {
+      unsigned long long result = 0;
+      for (auto it = myDependencyFunctors.begin(); it != myDependencyFunctors.end(); ++it)
+      {
+        result = combine_fingerprint(result, (*it)->fingerprint());
+      }
+      return result;
+    }
+
+    /// Return a new fingerprint, different from all earlier ones
+    unsigned long long module_functor_common::freshFingerprint()
+    {
+      static std::atomic<unsigned long long> counter(0);
+      return mix_fingerprint(++counter);
+    }
+
     /// Reset functor for all threads
     void module_functor_common::reset()
     {
@@ -1304,6 +1405,9 @@ namespace Gambit
       else
       {
         if (dependency_map.find(key) != dependency_map.end()) (*dependency_map[key])(dep_functor,this);
+        // keep track of the dependency for fingerprinting the inputs of this functor
+        if (std::find(myDependencyFunctors.begin(), myDependencyFunctors.end(), dep_functor) == myDependencyFunctors.end())
+          myDependencyFunctors.push_back(dep_functor);
         // propagate purpose from next to next-to-output nodes
         dep_functor->setPurpose(this->myPurpose);
       }
@@ -1546,6 +1650,17 @@ namespace Gambit
           }
         }
       }
+      if(myFingerprint==NULL)
+      {
+        #pragma omp critical(module_functor_common_init_memory_fingerprint)
+        {
+          if(myFingerprint==NULL)
+          {
+            myFingerprint = new unsigned long long[n];
+            for (int i = 0; i < n; ++i) myFingerprint[i] = freshFingerprint();
+          }
+        }
+      }
     }
 
     /// Do pre-calculate timing things
@@ -1565,6 +1680,10 @@ namespace Gambit
         pInvalidation = pInvalidation*(1-fadeRate) + fadeRate*FUNCTORS_BASE_INVALIDATION_RATE;
       }
       needs_recalculating[thread_num] = false;
+      // The result of a memoised or pure function is identified by the fingerprints of the inputs it was
+      // calculated from.  Any other function may depend on hidden state (static counters, backends, random
+      // numbers, loop iterations, ...), so its result gets a new fingerprint every time it is calculated.
+      myFingerprint[thread_num] = (myMemoCapacity > 0 or myPureFlag) ? inputFingerprint() : freshFingerprint();
     }
 
   /// Class methods for actual module functors for TYPE=void.
@@ -1677,6 +1796,21 @@ namespace Gambit
       receiver.setModelName(myValue->getModelName());
     }
 
+    /// Fingerprint of the current parameter values.  This is computed on request, as
+    /// primary parameters are set directly by the likelihood container.
+    unsigned long long model_functor::fingerprint(int index)
+    {
+      const ModelParameters &params = myValue[iRunNested ? index : 0];
+      unsigned long long result = 0;
+      for (auto it = params.begin(); it != params.end(); ++it)
+      {
+        unsigned long long bits;
+        std::memcpy(&bits, &(it->second), sizeof(bits));
+        result = combine_fingerprint(result, bits);
+      }
+      return result;
+    }
+
     /// @}
 
     /// @{ Primary model functor class method definitions
@@ -352,6 +352,64 @@ namespace Gambit
 
    /// @}
 
+   /// @{ Pre-resolved handles
+
+   SpectrumParHandle Spectrum::get_handle(const Par::Tags partype, const std::string& mass) const
+   {
+      SpectrumParHandle h;
+      h.HE = HE->get_handle(partype,mass);
+      h.LE = LE->get_handle(partype,mass);
+      h.label = "string reference '"+mass+"'";
+      return h;
+   }
+
+   SpectrumParHandle Spectrum::get_handle(const Par::Tags partype, const std::string& mass, const int index) const
+   {
+      SpectrumParHandle h;
+      h.HE = HE->get_handle(partype,mass,index);
+      h.LE = LE->get_handle(partype,mass,index);
+      h.label = "string reference '"+mass+"' and index '"+std::to_string(index)+"'";
+      return h;
+   }
+
+   SpectrumParHandle Spectrum::get_handle(const Par::Tags partype, const std::pair<int,int> pdgpr) const
+   {
+      /* If there is a short name, then use that plus the index */
+      if( Models::ParticleDB().has_short_name(pdgpr) )
+      {
+        std::pair<str,int> shortpr = Models::ParticleDB().short_name_pair(pdgpr);
+        return get_handle( partype, shortpr.first, shortpr.second );
+      }
+      else /* Use the long name with no index instead */
+      {
+        return get_handle( partype, Models::ParticleDB().long_name(pdgpr) );
+      }
+   }
+
+   bool Spectrum::has(const SpectrumParHandle& h) const
+   {
+      return (HE->has(h.HE) or LE->has(h.LE));
+   }
+
+   double Spectrum::get(const SpectrumParHandle& h) const
+   {
+     double result(-1);
+     if( HE->has(h.HE) )
+     { result = HE->get(h.HE); }
+     else if( LE->has(h.LE) )
+     { result = LE->get(h.LE); }
+     else
+     {
+        std::ostringstream errmsg;
+        errmsg << "Error retrieving particle spectrum data!" << std::endl;
+        errmsg << "No pole mass with "<<h.label<<" could be found in either LE or HE SubSpectrum!" <<std::endl;
+        utils_error().raise(LOCAL_INFO,errmsg.str());
+     }
+     return result;
+   }
+
+   /// @}
+
    /// @{ Getters which first check the sanity of the thing they are returning
 
    double Spectrum::safeget(const Par::Tags partype,
@@ -25,6 +25,7 @@
 
 #include <fstream>
 #include <string>
+#include <atomic>
 
 #include "gambit/Elements/subspectrum.hpp"
 #include "gambit/Elements/mssm_slhahelp.hpp"
@@ -200,11 +201,187 @@ namespace Gambit
 
    /// @}
 
+   /// @{ Pre-resolved parameter handles
+
+   /// Generate a new, globally unique override stamp
+   unsigned long long SubSpectrum::new_override_stamp()
+   {
+      static std::atomic<unsigned long long> counter(0);
+      return ++counter;
+   }
+
+   /// Fill in a handle with the override entries that could hide a parameter.
+   /// These mirror the searches done by FptrFinder::find, in the same order.
+   void SubSpectrum::fill_override_keys(SpecParHandle& h) const
+   {
+      typedef SpecParHandle::OverrideKey Key;
+      const Models::partmap& pdb = Models::ParticleDB();
+      if(h.nindices==0)
+      {
+         str antiname;
+         bool anti = h.check_antiparticle and pdb.has_particle(h.name) and pdb.has_antiparticle(h.name);
+         if(anti) antiname = pdb.get_antiparticle(h.name);
+         h.override_keys.push_back(Key{0, h.name, -1, -1});
+         if(pdb.has_short_name(h.name))
+         {
+            std::pair<str, int> p = pdb.short_name_pair(h.name);
+            h.override_keys.push_back(Key{1, p.first, p.second, -1});
+         }
+         if(anti)
+         {
+            h.override_keys.push_back(Key{0, antiname, -1, -1});
+            if(pdb.has_short_name(antiname))
+            {
+               std::pair<str, int> p = pdb.short_name_pair(antiname);
+               h.override_keys.push_back(Key{1, p.first, p.second, -1});
+            }
+         }
+      }
+      else if(h.nindices==1)
+      {
+         bool anti = h.check_antiparticle and pdb.has_particle(h.name,h.i) and pdb.has_antiparticle(h.name,h.i);
+         h.override_keys.push_back(Key{1, h.name, h.i, -1});
+         if(pdb.has_particle(h.name,h.i)) h.override_keys.push_back(Key{0, pdb.long_name(h.name,h.i), -1, -1});
+         if(anti)
+         {
+            std::pair<str,int> p = pdb.get_antiparticle(h.name,h.i);
+            h.override_keys.push_back(Key{1, p.first, p.second, -1});
+            if(pdb.has_particle(p)) h.override_keys.push_back(Key{0, pdb.long_name(p.first,p.second), -1, -1});
+         }
+      }
+      else
+      {
+         h.override_keys.push_back(Key{2, h.name, h.i, h.j});
+      }
+   }
+
+   /// Refresh the override value cached in a handle, if the override maps have changed since
+   const double* SubSpectrum::find_override(const SpecParHandle& h) const
+   {
+      if(h.stamp == override_stamp) return h.override_value;
+      h.stamp = override_stamp;
+      h.override_value = NULL;
+      const OverrideMaps& om = override_maps.at(h.partype);
+      for(std::vector<SpecParHandle::OverrideKey>::const_iterator k = h.override_keys.begin(); k != h.override_keys.end(); ++k)
+      {
+         if(k->nindices==0)
+         {
+            std::map<str,double>::const_iterator it = om.m0.find(k->name);
+            if(it != om.m0.end()) { h.override_value = &(it->second); break; }
+         }
+         else if(k->nindices==1)
+         {
+            std::map<str,std::map<int,double>>::const_iterator it = om.m1.find(k->name);
+            if(it == om.m1.end()) continue;
+            std::map<int,double>::const_iterator jt = it->second.find(k->i);
+            if(jt != it->second.end()) { h.override_value = &(jt->second); break; }
+         }
+         else
+         {
+            std::map<str,std::map<int,std::map<int,double>>>::const_iterator it = om.m2.find(k->name);
+            if(it == om.m2.end()) continue;
+            std::map<int,std::map<int,double>>::const_iterator jt = it->second.find(k->i);
+            if(jt == it->second.end()) continue;
+            std::map<int,double>::const_iterator kt = jt->second.find(k->j);
+            if(kt != jt->second.end()) { h.override_value = &(kt->second); break; }
+         }
+      }
+      return h.override_value;
+   }
+
+   /// Retrieve the parameter described by a handle using the string-based getters
+   double SubSpectrum::get_by_name(const SpecParHandle& h) const
+   {
+      if(h.nindices==0) return get(h.partype, h.name, h.check_overrides, SafeBool(h.check_antiparticle));
+      if(h.nindices==1) return get(h.partype, h.name, h.i, h.check_overrides, SafeBool(h.check_antiparticle));
+      return get(h.partype, h.name, h.i, h.j, h.check_overrides);
+   }
+
+   SpecParHandle SubSpectrum::get_handle(const Par::Tags partype, const str& name,
+                                         const SpecOverrideOptions check_overrides,
+                                         const SafeBool check_antiparticle) const
+   {
+      SpecParHandle h;
+      h.partype = partype;
+      h.name = name;
+      h.nindices = 0;
+      h.check_overrides = check_overrides;
+      h.check_antiparticle = check_antiparticle;
+      fill_override_keys(h);
+      return h;
+   }
+
+   SpecParHandle SubSpectrum::get_handle(const Par::Tags partype, const str& name, const int i,
+                                         const SpecOverrideOptions check_overrides,
+                                         const SafeBool check_antiparticle) const
+   {
+      SpecParHandle h;
+      h.partype = partype;
+      h.name = name;
+      h.i = i;
+      h.nindices = 1;
+      h.check_overrides = check_overrides;
+      h.check_antiparticle = check_antiparticle;
+      fill_override_keys(h);
+      return h;
+   }
+
+   SpecParHandle SubSpectrum::get_handle(const Par::Tags partype, const str& name, const int i, const int j,
+                                         const SpecOverrideOptions check_overrides) const
+   {
+      SpecParHandle h;
+      h.partype = partype;
+      h.name = name;
+      h.i = i;
+      h.j = j;
+      h.nindices = 2;
+      h.check_overrides = check_overrides;
+      h.check_antiparticle = false;
+      fill_override_keys(h);
+      return h;
+   }
+
+   /* Input PDG code plus context integer as pair */
+   SpecParHandle SubSpectrum::get_handle(const Par::Tags partype, const std::pair<int,int> pdgpr,
+                                         const SpecOverrideOptions check_overrides,
+                                         const SafeBool check_antiparticle) const
+   {
+      return get_handle(partype, Models::ParticleDB().long_name(pdgpr), check_overrides, check_antiparticle);
+   }
+
+   bool SubSpectrum::has(const SpecParHandle& h) const
+   {
+      if(not h.resolved()) utils_error().forced_throw(LOCAL_INFO,"Attempted to use a SpecParHandle that has not been set by SubSpectrum::get_handle.");
+      if(not (h.check_overrides == ignore_overrides) and find_override(h) != NULL) return true;
+      if(h.check_overrides == overrides_only) return false;
+      const void* domain = getter_domain();
+      if(h.getter_domain != domain or domain == NULL)
+      {
+         h.getter = resolve_getter(h.partype, h.name, h.i, h.j, h.nindices, SafeBool(h.check_antiparticle));
+         h.getter_domain = domain;
+      }
+      return bool(h.getter);
+   }
+
+   double SubSpectrum::get(const SpecParHandle& h) const
+   {
+      if(has(h))
+      {
+         const double* value = (h.check_overrides == ignore_overrides ? NULL : h.override_value);
+         return value != NULL ? *value : (*h.getter)(*this);
+      }
+      // Parameter not found; let the string-based getter raise the usual error.
+      return get_by_name(h);
+   }
+
+   /// @}
+
    /// @{ Parameter override functions
 
    void SubSpectrum::set_override(const Par::Tags partype,
                       const double value, const str& name, const bool allow_new, const bool decouple)
    {
+      override_stamp = new_override_stamp();
       bool done = false;
       // No index input; check if direct string exists in map
       // If not, try to use particle database to convert to short
@@ -358,6 +535,7 @@ namespace Gambit
    void SubSpectrum::set_override(const Par::Tags partype,
                       const double value, const str& name, const int i, const bool allow_new, const bool decouple)
    {
+      override_stamp = new_override_stamp();
       bool done = false;
       // One index input; check if direct string plus index exists in map
       // If not, try to use particle database to convert to long name
@@ -470,6 +648,7 @@ namespace Gambit
    void SubSpectrum::set_override(const Par::Tags partype,
                       const double value, const str& name, const int i, const int j, const bool allow_new)
    {
+      override_stamp = new_override_stamp();
       if(not allow_new and not has(partype,name,i,j) )
       {
         std::ostringstream errmsg;
@@ -21,6 +21,10 @@
 #ifndef __flav_utils_hpp__
 #define __flav_utils_hpp__
 
+#include <vector>
+
+#include "gambit/FlavBit/FlavBit_types.hpp"
+
 #include <boost/numeric/ublas/lu.hpp>
 #include <boost/numeric/ublas/matrix.hpp>
 
@@ -56,6 +60,43 @@ namespace Gambit
       return true;
     }
 
+    /// Evaluator of chi^2 = diff^T (cov_exp + cov_th)^-1 diff.
+    /// The Cholesky factor of the total covariance is kept between calls:
+    /// it is reused if the covariance has not changed, updated by rank-1
+    /// updates if only a few diagonal theory errors have changed, and
+    /// otherwise refactorised from the first changed row onwards.
+    class Cholesky_chi2
+    {
+
+      public:
+
+        Cholesky_chi2() : dim(0), n_updates(0), use_lu(false) {}
+
+        /// Return the chi^2 for a set of predictions, measurements and covariances
+        double operator()(const predictions_measurements_covariances &pmc);
+
+      private:
+
+        /// Refresh the factorisation for the current covariances
+        void update(const predictions_measurements_covariances &pmc);
+        /// Cholesky factorisation of rows first..dim-1; false if not positive definite
+        bool factorise(int first);
+        /// Rank-1 update (sign > 0) or downdate (sign < 0) of the factor with x*x^T
+        bool rank1(std::vector<double> x, int first, int sign);
+
+        int dim;
+        /// Covariances last used, stored dense and row-major
+        std::vector<double> cov_exp, cov_th;
+        /// Lower-triangular Cholesky factor of cov_exp + cov_th, row-major
+        std::vector<double> L;
+        /// Inverse of the total covariance, used if it is not positive definite
+        ublas::matrix<double> cov_inv;
+        /// Rank-1 updates since the last full factorisation
+        int n_updates;
+        bool use_lu;
+
+    };
+
   }
 
 }
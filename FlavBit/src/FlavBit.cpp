@@ -1125,30 +1125,13 @@ namespace Gambit
 
       if (flav_debug) cout<<"Starting b2sll_likelihood"<<endl;
 
-      // Get experimental measurements
-      predictions_measurements_covariances pmc=*Dep::b2sll_M;
+      static Cholesky_chi2 chi2;
 
-      // Get experimental covariance
-      boost::numeric::ublas::matrix<double> cov=pmc.cov_exp;
+      // Get predictions, measurements and covariances
+      const predictions_measurements_covariances &pmc = *Dep::b2sll_M;
 
-      // adding theory and experimenta covariance
-      cov+=pmc.cov_th;
-
-      //calculating a diff
-      vector<double> diff;
-      diff=pmc.diff;
-      boost::numeric::ublas::matrix<double> cov_inv(pmc.dim, pmc.dim);
-      InvertMatrix(cov, cov_inv);
-
-      double Chi2=0;
-
-      for (int i=0; i < pmc.dim; ++i)
-      {
-        for (int j=0; j<pmc.dim; ++j)
-        {
-          Chi2+= diff[i] * cov_inv(i,j)*diff[j] ;
-        }
-      }
+      // chi^2 with the sum of theory and experimental covariances
+      double Chi2 = chi2(pmc);
 
       result=-0.5*Chi2;
 
@@ -1307,30 +1290,13 @@ namespace Gambit
 
       if (flav_debug) cout<<"Starting b2ll_likelihood"<<endl;
 
-      predictions_measurements_covariances pmc = *Dep::b2ll_M;
+      static Cholesky_chi2 chi2;
 
-      boost::numeric::ublas::matrix<double> cov=pmc.cov_exp;
+      // Get predictions, measurements and covariances
+      const predictions_measurements_covariances &pmc = *Dep::b2ll_M;
 
-      // adding theory and experimental covariance
-      cov+=pmc.cov_th;
-
-      //calculating a diff
-      vector<double> diff;
-      diff=pmc.diff;
-
-      boost::numeric::ublas::matrix<double> cov_inv(pmc.dim, pmc.dim);
-      InvertMatrix(cov, cov_inv);
-
-      // calculating the chi2
-      double Chi2=0;
-
-      for (int i=0; i < pmc.dim; ++i)
-      {
-        for (int j=0; j<pmc.dim; ++j)
-        {
-          Chi2+= diff[i] * cov_inv(i,j)*diff[j];
-        }
-      }
+      // chi^2 with the sum of theory and experimental covariances
+      double Chi2 = chi2(pmc);
 
       result=-0.5*Chi2;
 
@@ -1444,28 +1410,13 @@ namespace Gambit
 
       if (flav_debug) cout<<"Starting SL_likelihood"<<endl;
 
-      predictions_measurements_covariances pmc = *Dep::SL_M;
-
-      boost::numeric::ublas::matrix<double> cov=pmc.cov_exp;
+      static Cholesky_chi2 chi2;
 
-      // adding theory and experimental covariance
-      cov+=pmc.cov_th;
+      // Get predictions, measurements and covariances
+      const predictions_measurements_covariances &pmc = *Dep::SL_M;
 
-      //calculating a diff
-      vector<double> diff;
-      diff=pmc.diff;
-
-      boost::numeric::ublas::matrix<double> cov_inv(pmc.dim, pmc.dim);
-      InvertMatrix(cov, cov_inv);
-
-      double Chi2=0;
-      for (int i=0; i < pmc.dim; ++i)
-      {
-        for (int j=0; j<pmc.dim; ++j)
-        {
-          Chi2+= diff[i] * cov_inv(i,j)*diff[j];
-        }
-      }
+      // chi^2 with the sum of theory and experimental covariances
+      double Chi2 = chi2(pmc);
 
       result=-0.5*Chi2;
 
@@ -1555,28 +1506,13 @@ namespace Gambit
 
       if (flav_debug) cout<<"Starting LUV_likelihood"<<endl;
 
-      predictions_measurements_covariances pmc = *Dep::LUV_M;
-
-      boost::numeric::ublas::matrix<double> cov=pmc.cov_exp;
-
-      // adding theory and experimental covariance
-      cov+=pmc.cov_th;
+      static Cholesky_chi2 chi2;
 
-      //calculating a diff
-      vector<double> diff;
-      diff=pmc.diff;
+      // Get predictions, measurements and covariances
+      const predictions_measurements_covariances &pmc = *Dep::LUV_M;
 
-      boost::numeric::ublas::matrix<double> cov_inv(pmc.dim, pmc.dim);
-      InvertMatrix(cov, cov_inv);
-
-      double Chi2=0;
-      for (int i=0; i < pmc.dim; ++i)
-        {
-          for (int j=0; j<pmc.dim; ++j)
-            {
-              Chi2+= diff[i] * cov_inv(i,j)*diff[j];
-            }
-        }
+      // chi^2 with the sum of theory and experimental covariances
+      double Chi2 = chi2(pmc);
 
       result=-0.5*Chi2;
 
@@ -0,0 +1,201 @@
+//   GAMBIT: Global and Modular BSM Inference Tool
+//   *********************************************
+///  \file
+///
+///  Implementations of helper utilities for
+///  FlavBit.
+///
+///  *********************************************
+
+#include <cmath>
+
+#include "gambit/FlavBit/flav_utils.hpp"
+
+
+namespace Gambit
+{
+
+  namespace FlavBit
+  {
+
+    /// Implementation of Cholesky_chi2 methods
+    /// @{
+
+    /// Maximum number of rank-1 updates before the factor is recomputed from scratch
+    static const int max_updates = 100;
+
+    /// Return the chi^2 for a set of predictions, measurements and covariances
+    double Cholesky_chi2::operator()(const predictions_measurements_covariances &pmc)
+    {
+      update(pmc);
+
+      const std::vector<double> &diff = pmc.diff;
+      double Chi2 = 0;
+
+      if (use_lu)
+      {
+        for (int i=0; i < dim; ++i)
+        {
+          for (int j=0; j < dim; ++j)
+          {
+            Chi2 += diff[i] * cov_inv(i,j) * diff[j];
+          }
+        }
+        return Chi2;
+      }
+
+      // chi^2 = |z|^2 with L z = diff
+      std::vector<double> z(dim);
+      for (int i=0; i < dim; ++i)
+      {
+        double s = diff[i];
+        const double *Li = &L[i*dim];
+        for (int k=0; k < i; ++k) s -= Li[k]*z[k];
+        z[i] = s/Li[i];
+        Chi2 += z[i]*z[i];
+      }
+      return Chi2;
+    }
+
+    /// Refresh the factorisation for the current covariances
+    void Cholesky_chi2::update(const predictions_measurements_covariances &pmc)
+    {
+      const int n = pmc.dim;
+      bool full = (n != dim or use_lu);
+
+      if (n != dim)
+      {
+        dim = n;
+        cov_exp.assign(n*n, 0.);
+        cov_th.assign(n*n, 0.);
+        L.assign(n*n, 0.);
+      }
+
+      // The experimental covariance is normally fixed for the whole scan
+      for (int i=0; i < n; ++i)
+      {
+        for (int j=0; j < n; ++j)
+        {
+          if (cov_exp[i*n+j] != pmc.cov_exp(i,j))
+          {
+            cov_exp[i*n+j] = pmc.cov_exp(i,j);
+            full = true;
+          }
+        }
+      }
+
+      // Find the changes to the theory covariance
+      int first = n;
+      bool diagonal = true;
+      std::vector<int> changed;
+      std::vector<double> delta;
+      for (int i=0; i < n; ++i)
+      {
+        for (int j=0; j < n; ++j)
+        {
+          double d = pmc.cov_th(i,j) - cov_th[i*n+j];
+          if (d != 0.)
+          {
+            if (i == j)
+            {
+              changed.push_back(i);
+              delta.push_back(d);
+            }
+            else diagonal = false;
+            first = std::min(first, std::max(i,j));
+            cov_th[i*n+j] = pmc.cov_th(i,j);
+          }
+        }
+      }
+
+      if (not full)
+      {
+        // Unchanged covariance: keep the factorisation
+        if (first == n) return;
+
+        // Few diagonal changes: rank-1 updates with sqrt(|delta|) e_i
+        if (diagonal and n_updates + int(changed.size()) <= max_updates and 4*int(changed.size()) <= n)
+        {
+          bool ok = true;
+          for (size_t k=0; ok and k < changed.size(); ++k)
+          {
+            std::vector<double> x(n, 0.);
+            x[changed[k]] = std::sqrt(std::fabs(delta[k]));
+            ok = rank1(x, changed[k], delta[k] > 0 ? 1 : -1);
+          }
+          n_updates += changed.size();
+          if (ok) return;
+          full = true;
+        }
+      }
+
+      // Otherwise refactorise; rows before the first change are unaffected
+      if (full) first = 0;
+      if (first == 0) n_updates = 0;
+      use_lu = not factorise(first);
+      if (use_lu)
+      {
+        // Not positive definite; fall back to LU inversion
+        ublas::matrix<double> cov(n, n);
+        for (int i=0; i < n; ++i)
+        {
+          for (int j=0; j < n; ++j) cov(i,j) = cov_exp[i*n+j] + cov_th[i*n+j];
+        }
+        cov_inv.resize(n, n);
+        InvertMatrix(cov, cov_inv);
+      }
+    }
+
+    /// Cholesky factorisation of rows first..dim-1; false if not positive definite
+    bool Cholesky_chi2::factorise(int first)
+    {
+      const int n = dim;
+      for (int i=first; i < n; ++i)
+      {
+        double *Li = &L[i*n];
+        for (int j=0; j <= i; ++j)
+        {
+          const double *Lj = &L[j*n];
+          double s = cov_exp[i*n+j] + cov_th[i*n+j];
+          for (int k=0; k < j; ++k) s -= Li[k]*Lj[k];
+          if (i == j)
+          {
+            if (not (s > 0.)) return false;
+            Li[i] = std::sqrt(s);
+          }
+          else Li[j] = s/Lj[j];
+        }
+        for (int j=i+1; j < n; ++j) Li[j] = 0.;
+      }
+      return true;
+    }
+
+    /// Rank-1 update (sign > 0) or downdate (sign < 0) of the factor with x*x^T.
+    /// x must vanish before index first.
+    bool Cholesky_chi2::rank1(std::vector<double> x, int first, int sign)
+    {
+      const int n = dim;
+      for (int k=first; k < n; ++k)
+      {
+        double Lkk = L[k*n+k];
+        double r2 = Lkk*Lkk + sign*x[k]*x[k];
+        if (not (r2 > 0.)) return false;
+        double r = std::sqrt(r2);
+        double c = r/Lkk;
+        double s = x[k]/Lkk;
+        L[k*n+k] = r;
+        for (int i=k+1; i < n; ++i)
+        {
+          double &Lik = L[i*n+k];
+          Lik = (Lik + sign*s*x[i])/c;
+          x[i] = c*x[i] - s*Lik;
+        }
+      }
+      return true;
+    }
+
+    /// @}
+
+  }
+
+}
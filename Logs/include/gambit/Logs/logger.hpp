@@ -58,6 +58,10 @@ namespace Gambit
      typedef ios_type& (*manip2)( ios_type& );
      typedef std::ios_base& (*manip3)( std::ios_base& );
 
+     /// Check if the message currently being streamed will be ignored, so that
+     /// its remaining pieces need not be formatted
+     bool rejecting(LogMaster&);
+
      /// @{ Stream functions for use with LogMaster
      LogMaster& operator<<(LogMaster&, const std::string&);
      LogMaster& operator<<(LogMaster&, const LogTag&);
@@ -77,6 +81,7 @@ namespace Gambit
      LogMaster& operator << (LogMaster& logobj, const TYPE& input)
      {
        using ::Gambit::operator<<; // Unhide operator overloads in Gambit scope
+       if (rejecting(logobj)) return logobj;
        std::stringstream ss;
        ss << input;
        logobj << ss.str();
@@ -87,6 +92,7 @@ namespace Gambit
      LogMaster& operator << (LogMaster& logobj, TYPE& input)
      {
        using ::Gambit::operator<<; // Unhide operator overloads in Gambit scope
+       if (rejecting(logobj)) return logobj;
        std::stringstream ss;
        ss << input;
        logobj << ss.str();
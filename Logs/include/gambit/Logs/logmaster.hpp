@@ -122,6 +122,16 @@ namespace Gambit
         void send(const std::ostringstream&, std::set<LogTag>&);
         void send(const std::ostringstream&, std::set<int>&);
 
+        /// Check if messages carrying a given tag will certainly be ignored, so that they
+        /// need not be constructed at all (always false until the loggers are initialised)
+        bool ignoring(int tag) const
+        {
+          return loggers_readyQ and (silenced or ignore.find(tag) != ignore.end());
+        }
+
+        /// Check if the message currently being streamed by this thread will be ignored
+        bool rejecting();
+
         /// Set the internal variables tracking which module and/or backend is currently running
         void entering_module(int);
         void leaving_module();
@@ -178,6 +188,9 @@ namespace Gambit
         std::ostringstream* stream;
         std::set<int>* streamtags;
 
+        /// Flags marking streamed messages that have received an ignored tag
+        bool* streamrejected;
+
         /// Messages sent before logger objects are created will be buffered
         /// Same for messages sent while inside omp parallel blocks
         std::deque<Message>* backlog;
@@ -48,6 +48,12 @@ namespace Gambit
      
      /// {@ Stream functions overloads for working with the logger
 
+     /// Check if the message currently being streamed will be ignored
+     bool rejecting(LogMaster& logobj)
+     {
+        return logobj.rejecting();
+     }
+
      /// @{ Stream functions for use with LogMaster
      LogMaster& operator<<(LogMaster& logobj, const std::string& in)
      {
@@ -64,6 +64,7 @@ namespace Gambit
       , current_backend(NULL)
       , stream         (NULL)
       , streamtags     (NULL)
+      , streamrejected (NULL)
       , backlog        (NULL)
     {
       // Note! MPIrank and MPIsize will not be correct until initialisation occurs!
@@ -84,6 +85,7 @@ namespace Gambit
       , current_backend(NULL)
       , stream         (NULL)
       , streamtags     (NULL)
+      , streamrejected (NULL)
       , backlog        (NULL)
     {
       // Note! MPIrank and MPIsize will not be correct until initialisation occurs!
@@ -108,6 +110,17 @@ namespace Gambit
           if(streamtags==NULL) streamtags = new std::set<int>[n];
         }
       }
+      if(streamrejected==NULL)
+      {
+        #pragma omp critical(logmaster_common_init_memory_streamrejected)
+        {
+          if(streamrejected==NULL)
+          {
+            streamrejected = new bool[n];
+            std::fill(streamrejected, streamrejected+n, false);
+          }
+        }
+      }
       if(backlog==NULL)
       {
         #pragma omp critical(logmaster_common_init_memory_backlog)
@@ -213,6 +226,7 @@ namespace Gambit
        // Delete the thread variables
        if (stream != NULL)         delete [] stream;
        if (streamtags != NULL)     delete [] streamtags;
+       if (streamrejected != NULL) delete [] streamrejected;
        if (backlog != NULL)        delete [] backlog;
        if (current_module !=NULL)  delete [] current_module;
        if (current_backend !=NULL) delete [] current_backend;
@@ -554,6 +568,9 @@ namespace Gambit
          tags.insert(current_backend[i]);
        }
 
+       // Drop messages that would be ignored anyway, rather than buffering them
+       if(loggers_readyQ and (silenced or not Utils::is_disjoint(tags, ignore))) return;
+
        // If the loggers have not yet been initialised, buffer the message
        if(omp_get_level()!=0 or not loggers_readyQ)
        {
@@ -630,6 +647,8 @@ namespace Gambit
     {
        init_memory();
        current_backend[omp_get_thread_num()] = i;
+       // Skip the message entirely (no formatting) when debug messages are ignored
+       if (ignoring(debug)) return;
        *this<<"Setting current_backend="<<i;
        *this<<logs<<debug<<EOM;
     }
@@ -640,6 +659,7 @@ namespace Gambit
        cb_test = current_backend[omp_get_thread_num()];
        if (cb_test == -1) return;
        current_backend[omp_get_thread_num()] = -1;
+       if (ignoring(debug)) return;
        *this<<"Restoring current_backend="<<-1;
        *this<<logs<<debug<<EOM;
     }
@@ -648,7 +668,24 @@ namespace Gambit
     void LogMaster::input(const LogTag& tag)
     {
        init_memory();
-       streamtags[omp_get_thread_num()].insert(tag);
+       int i = omp_get_thread_num();
+       if (streamrejected[i]) return;
+       if (ignoring(tag))
+       {
+         // The message will be ignored; stop collecting it
+         streamrejected[i] = true;
+         stream[i].str(std::string());
+         streamtags[i].clear();
+         return;
+       }
+       streamtags[i].insert(tag);
+    }
+
+    /// Check if the message currently being streamed by this thread will be ignored
+    bool LogMaster::rejecting()
+    {
+       init_memory();
+       return streamrejected[omp_get_thread_num()];
     }
 
     /// Handle end of message character
@@ -656,8 +693,12 @@ namespace Gambit
     {
        init_memory();
        size_t i = omp_get_thread_num();
-       // Collect the stream and tags, then send the message
-       send(stream[i].str(), streamtags[i]);
+       if (not streamrejected[i])
+       {
+         // Collect the stream and tags, then send the message
+         send(stream[i].str(), streamtags[i]);
+       }
+       streamrejected[i] = false;
        // Clear stream and tags for next message;
        stream[i].str(std::string()); //TODO: check that this works properly on all compilers...
        streamtags[i].clear();
@@ -667,26 +708,30 @@ namespace Gambit
     void LogMaster::input(const std::string& in)
     {
        init_memory();
-       stream[omp_get_thread_num()] << in;
+       int i = omp_get_thread_num();
+       if (not streamrejected[i]) stream[i] << in;
     }
 
     /// Handle various stream manipulators
     void LogMaster::input(const manip1 fp)
     {
        init_memory();
-       stream[omp_get_thread_num()] << fp;
+       int i = omp_get_thread_num();
+       if (not streamrejected[i]) stream[i] << fp;
     }
 
     void LogMaster::input(const manip2 fp)
     {
        init_memory();
-       stream[omp_get_thread_num()] << fp;
+       int i = omp_get_thread_num();
+       if (not streamrejected[i]) stream[i] << fp;
     }
 
     void LogMaster::input(const manip3 fp)
     {
        init_memory();
-       stream[omp_get_thread_num()] << fp;
+       int i = omp_get_thread_num();
+       if (not streamrejected[i]) stream[i] << fp;
     }
 
     /// @}
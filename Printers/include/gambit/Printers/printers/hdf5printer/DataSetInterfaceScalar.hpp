@@ -49,6 +49,7 @@ namespace Gambit {
 
           std::vector<T> read_buffer; // Buffer to store a chunk of the linked dataset (during read operations)
           std::size_t    read_buffer_start; // Index of start of read buffer
+          std::size_t    read_length; // Number of entries read into the read buffer at once (multiple of CHUNKLENGTH)
 
         public: 
           /// Constructors
@@ -76,6 +77,10 @@ namespace Gambit {
          // Extract entry at given index from dataset
          T get_entry(std::size_t index);
 
+         // Set the number of entries that get_entry reads into memory at once
+         // (rounded up to a multiple of CHUNKLENGTH)
+         void set_read_length(std::size_t length);
+
          /// @}
 
       };
@@ -90,11 +95,13 @@ namespace Gambit {
       template<class T, std::size_t CL>
       DataSetInterfaceScalar<T,CL>::DataSetInterfaceScalar() 
         : DataSetInterfaceBase<T,0,CL>()
+        , read_length(CL)
       {}
 
       template<class T, std::size_t CL>
       DataSetInterfaceScalar<T,CL>::DataSetInterfaceScalar(hid_t location_id, const std::string& name, const bool resume, const char access) 
         : DataSetInterfaceBase<T,0,CL>(location_id, name, empty_rdims, resume, access)
+        , read_length(CL)
       {}
 
       template<class T, std::size_t CHUNKLENGTH>
@@ -408,8 +415,9 @@ namespace Gambit {
      T DataSetInterfaceScalar<T,CHUNKLENGTH>::get_entry(std::size_t index)
      {
         // Figure out relevant chunk start index and position of desired entry in the chunk.
-        std::size_t chunk_start = (index / CHUNKLENGTH) * CHUNKLENGTH;
-        std::size_t chunk_relative_index = index % CHUNKLENGTH;
+        // (a "chunk" here is a block of read_length entries, i.e. one or more dataset chunks)
+        std::size_t chunk_start = (index / read_length) * read_length;
+        std::size_t chunk_relative_index = index % read_length;
 
         #ifdef HDF5_DEBUG
         std::cout << "index      :" << index << std::endl;
@@ -425,7 +433,7 @@ namespace Gambit {
            std::cout << "extracting new chunk starting from "<<chunk_start<< std::endl;
            #endif
            // Make sure we don't try to read past the end of the dataset
-           std::size_t length = CHUNKLENGTH; 
+           std::size_t length = read_length;
            if(chunk_start+length > this->dset_length())
            {
               length = this->dset_length() - chunk_start;
@@ -437,6 +445,15 @@ namespace Gambit {
         return read_buffer.at(chunk_relative_index);
      }
 
+     /// Set the number of entries that get_entry reads into memory at once
+     template<class T, std::size_t CHUNKLENGTH>
+     void DataSetInterfaceScalar<T,CHUNKLENGTH>::set_read_length(std::size_t length)
+     {
+        std::size_t nchunks = (length + CHUNKLENGTH - 1) / CHUNKLENGTH;
+        read_length = (nchunks > 0 ? nchunks : 1) * CHUNKLENGTH;
+        read_buffer.clear();
+     }
+
      ///   @}
 
      /// @}
@@ -21,6 +21,7 @@
 #define __hdf5_combine_tools_hpp__
 
 #include <vector>
+#include <limits>
 #include <sstream>
 #include <unordered_set>
 #include <unordered_map> 
@@ -41,6 +42,9 @@ namespace Gambit
             template <typename T>
             inline T type_ret(){return T();}
 
+            /// Marker for RA points with no matching point in the primary datasets
+            static const unsigned long long RA_NO_TARGET = std::numeric_limits<unsigned long long>::max();
+
             template <class U, typename... T>
             void Enter_HDF5(hid_t dataset, T&... params);
 
@@ -190,7 +194,7 @@ namespace Gambit
             struct ra_copy_hdf5
             {
                 template <typename U>
-                static void run (U, hid_t &dataset_out, hid_t &dataset2_out, std::vector<hid_t> &datasets, std::vector<hid_t> &datasets2, const unsigned long long size, const std::unordered_map<PPIDpair, unsigned long long, PPIDHash, PPIDEqual>& RA_write_hash, const std::vector<std::vector <unsigned long long> > &pointid, const std::vector<std::vector <unsigned long long> > &rank, const std::vector<unsigned long long> &aux_sizes, hid_t &/*old_dataset*/, hid_t &/*old_dataset2*/)
+                static void run (U, hid_t &dataset_out, hid_t &dataset2_out, std::vector<hid_t> &datasets, std::vector<hid_t> &datasets2, const unsigned long long size, const std::vector<std::vector <unsigned long long> > &RA_targets, const std::vector<std::vector <unsigned long long> > &pointid, const std::vector<std::vector <unsigned long long> > &rank, const std::vector<unsigned long long> &aux_sizes, hid_t &/*old_dataset*/, hid_t &/*old_dataset2*/)
                 {
                     std::vector<U> output(size, 0);
                     std::vector<int> valids(size, 0);
@@ -251,6 +255,7 @@ namespace Gambit
                        printer_error().raise(LOCAL_INFO, errmsg.str()); \
                     }
                     DSET_SIZE_CHECK(datasets2)
+                    DSET_SIZE_CHECK(RA_targets)
                     DSET_SIZE_CHECK(aux_sizes)
                     DSET_SIZE_CHECK(pointid)
                     DSET_SIZE_CHECK(rank)
@@ -264,9 +269,10 @@ namespace Gambit
                     auto st = aux_sizes.begin();
                     auto pt = pointid.begin(); 
                     auto ra = rank.begin();
+                    auto tg = RA_targets.begin();
                     auto itv = datasets2.begin();
                     for (auto it = datasets.begin(); it != datasets.end(); 
-                         ++it, ++itv, ++pt, ++ra, ++st)
+                         ++it, ++itv, ++pt, ++ra, ++tg, ++st)
                     {
                        if(*it < 0)
                        {
@@ -300,18 +306,17 @@ namespace Gambit
                           {
                               if (valid[i])
                               {
-                                  // Look up target for write in hash map
-                                  std::unordered_map<PPIDpair, unsigned long long, PPIDHash, PPIDEqual>::const_iterator ihash = RA_write_hash.find(PPIDpair((*pt)[i],(*ra)[i]));
-                                  if(ihash != RA_write_hash.end())
+                                  // Look up target for write (precomputed from the hash map)
+                                  if((size_t)i < tg->size() and (*tg)[i] != RA_NO_TARGET)
                                   {
                                       // found hash key, copy data
-                                      unsigned long long temp = ihash->second;
-                                      if(temp > size)
+                                      unsigned long long temp = (*tg)[i];
+                                      if(temp >= size)
                                       {
                                           std::ostringstream errmsg;
                                           errmsg << "Error copying random access parameter. The hash entry for "
                                           << "pt number " << (*pt)[i] << " of rank " << (*ra)[i]  
-                                          << " targets the point outside the size of the output dataset ("<<temp<<" > "<<size<<")." 
+                                          << " targets the point outside the size of the output dataset ("<<temp<<" >= "<<size<<")." 
                                           << "This indicates"
                                           << " a bug in the hash generation, please report it."; 
                                           printer_error().raise(LOCAL_INFO, errmsg.str());
@@ -322,9 +327,10 @@ namespace Gambit
                                   else
                                   {
                                      std::ostringstream errmsg;
-                                     errmsg << "Error copying random access parameter. Could not find "
-                                     << "pt number " << (*pt)[i] << " of rank " << (*ra)[i]  
-                                     << " in the output dataset (hash entry was not found).";
+                                     errmsg << "Error copying random access parameter. Could not find ";
+                                     if((size_t)i < pt->size()) errmsg << "pt number " << (*pt)[i] << " of rank " << (*ra)[i];
+                                     else errmsg << "entry " << i << " (beyond the " << pt->size() << " valid RA point IDs for this file)";
+                                     errmsg << " in the output dataset (hash entry was not found).";
                                      printer_error().raise(LOCAL_INFO, errmsg.str());
                                   }
                               }
@@ -445,9 +451,14 @@ namespace Gambit
                 std::vector<hid_t> aux_groups;
                 std::vector<std::string> file_names; // Names of temp files to combine
                 bool custom_mode; // Running in mode which allows 'custom' filenames (for combining output from multiple runs)
+                size_t worker;    // Index of this worker in parallel combine mode
+                size_t n_workers; // Number of workers in parallel combine mode (1 for serial combination)
+                std::unordered_map<std::string, size_t> param_worker; // Worker responsible for each (primary or aux) parameter
+                void assign_workers(); // Share the parameters out between the workers
+                bool owns(const std::string &name) const; // Check whether a parameter is assigned to this worker
 
             public:
-                hdf5_stuff(const std::string &base_file_name, const std::string &output_file, const std::string &group_name, const size_t num, const bool cleanup, const bool skip, const std::vector<std::string>& input_files);
+                hdf5_stuff(const std::string &base_file_name, const std::string &output_file, const std::string &group_name, const size_t num, const bool cleanup, const bool skip, const std::vector<std::string>& input_files, const size_t worker = 0, const size_t n_workers = 1);
                 ~hdf5_stuff(); // close files on destruction                
                 void Enter_Aux_Parameters(const std::string &output_file, bool resume = false);
             };
@@ -458,6 +469,32 @@ namespace Gambit
                 
                 stuff.Enter_Aux_Parameters(output_file, resume);
             }
+
+            /// Parallel version of combine_hdf5_files. The parameters are shared out between n_workers
+            /// worker processes, each of which combines its own datasets (primary and auxilliary) into
+            /// a separate part file. The part files are then merged into output_file.
+            void combine_hdf5_files_parallel(const std::string output_file, const std::string &base_file_name, const std::string &group, const size_t num, const bool resume, const bool cleanup, const bool skip, const size_t n_workers, const std::vector<std::string> input_files = std::vector<std::string>());
+
+            /// Run a single worker of the parallel combination, writing into the part file for this worker.
+            /// Any previous combined output must already have been moved to combine_backup_name(output_file).
+            inline void combine_hdf5_files_part(const std::string output_file, const std::string &base_file_name, const std::string &group, const size_t num, const bool resume, const bool skip, const size_t worker, const size_t n_workers, const std::vector<std::string> input_files = std::vector<std::string>())
+            {
+                hdf5_stuff stuff(base_file_name, output_file, group, num, false, skip, input_files, worker, n_workers);
+
+                stuff.Enter_Aux_Parameters(output_file, resume);
+            }
+
+            /// Merge the part files written by the workers of a parallel combination into output_file
+            void merge_combined_parts(const std::string &output_file, const std::string &group, const size_t n_workers);
+
+            /// Name of the file into which a worker of the parallel combination writes its datasets
+            std::string combine_part_name(const std::string &output_file, const size_t worker);
+
+            /// Name to which previous combined output is moved while it is merged with new temporary files
+            std::string combine_backup_name(const std::string &output_file);
+
+            /// Delete the temporary files (and backup of previous combined output) after a successful combination
+            void remove_combined_inputs(const std::string &output_file, const std::string &base_file_name, const size_t num, const bool resume);
   
             // Helper function to compute target point hash for RA combination
             std::unordered_map<PPIDpair, unsigned long long, PPIDHash, PPIDEqual> get_RA_write_hash(hid_t, std::unordered_set<PPIDpair,PPIDHash,PPIDEqual>&);
@@ -24,6 +24,8 @@
 #include "gambit/Printers/printers/hdf5printer/DataSetInterfaceScalar.hpp"
 #include "gambit/Utils/cats.hpp"
 
+#include <unordered_map>
+
 #include <boost/preprocessor/seq/for_each_i.hpp>
 
 #ifndef __hdf5_reader_hpp__
@@ -39,6 +41,10 @@ namespace Gambit
     /// to write the files in the first place.
     static const std::size_t CHUNKLENGTH = 100;
 
+    /// Number of entries read into memory at once when retrieving data.
+    /// Reading many chunks per access keeps sequential reads close to disk bandwidth.
+    static const std::size_t READLENGTH = 100*CHUNKLENGTH;
+
     template<class T>
     struct BuffPair
     {
@@ -53,7 +59,10 @@ namespace Gambit
        BuffPair(hid_t location_id, const std::string& name)
          : data   (location_id,name,true,'r')
          , isvalid(location_id,name+"_isvalid",true,'r')
-       {}
+       {
+         data.set_read_length(READLENGTH);
+         isvalid.set_read_length(READLENGTH);
+       }
        // Default constructor, data uninitialised!
        BuffPair() {}
     };
@@ -142,6 +151,14 @@ namespace Gambit
         ulong    mem_index;
         PPIDpair mem_point;
 
+        // Index of the first dataset entry for every PPID in the input data, built on first
+        // use from the pointID/MPIrank datasets. Used for arbitrary ("random access") retrieval.
+        std::unordered_map<PPIDpair, ulong, PPIDHash, PPIDEqual> ppid_index;
+        bool ppid_index_built;
+
+        // Build the PPID index
+        void build_PPID_index();
+
         // Search for the PPID supplied in the input data and return the index of the first match
         ulong get_index_from_PPID(const PPIDpair);
 
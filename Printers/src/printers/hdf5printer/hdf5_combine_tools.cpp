@@ -29,6 +29,11 @@
 #include "gambit/Printers/printers/hdf5printer/DataSetInterfaceScalar.hpp"
 #include "gambit/Utils/util_functions.hpp"
 
+#include <cstdio>
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
 // flag to trigger debug output
 //#define COMBINE_DEBUG
 
@@ -223,6 +228,26 @@ namespace Gambit
                 HDF5::closeDataset(dataset2_out);
             }
 
+            /// Create the output datasets for a parameter (unless this has already been done), with
+            /// types matching those of the given input datasets.
+            inline void create_output_datasets(hid_t new_group, const std::string &name, hid_t dataset, hid_t dataset2, unsigned long long size_tot, std::unordered_set<std::string> &created)
+            {
+                if(created.find(name) != created.end()) return;
+
+                hid_t type  = H5Dget_type(dataset);
+                hid_t type2 = H5Dget_type(dataset2);
+                if(type<0 or type2<0)
+                {
+                   std::ostringstream errmsg;
+                   errmsg << "Failed to detect type for dataset '"<<name<<"'! The dataset is supposedly valid, so this does not make sense. It must be a bug, please report it.";
+                   printer_error().raise(LOCAL_INFO, errmsg.str());
+                }
+                setup_hdf5_points(new_group, type, type2, size_tot, name);
+                H5Tclose(type);
+                H5Tclose(type2);
+                created.insert(name);
+            }
+
             inline std::vector<std::string> getGroups(std::string groups)
             {
                 std::string::size_type pos = groups.find_first_of("/");
@@ -241,7 +266,7 @@ namespace Gambit
                 return ret;
             }
 
-            hdf5_stuff::hdf5_stuff(const std::string &file_name, const std::string &output_file, const std::string &group_name, const size_t num, const bool cleanup, const bool skip, const std::vector<std::string>& file_names_in)
+            hdf5_stuff::hdf5_stuff(const std::string &file_name, const std::string &output_file, const std::string &group_name, const size_t num, const bool cleanup, const bool skip, const std::vector<std::string>& file_names_in, const size_t worker, const size_t n_workers)
               : group_name(group_name)
               , cum_sizes(num, 0)
               , sizes(num, 0)
@@ -254,6 +279,8 @@ namespace Gambit
               , aux_groups(num,-1)
               , file_names(file_names_in)
               , custom_mode(file_names.size()>0) // Running in mode which allows 'custom' filenames (for combining output from multiple runs)
+              , worker(worker)
+              , n_workers(n_workers)
 
            {
                 if(custom_mode)
@@ -270,14 +297,14 @@ namespace Gambit
                         errmsg << "  Number of files to be combined (num="<<num<<") is less than two! Therefore there is no combining to be done!"<<std::endl;
                         printer_error().raise(LOCAL_INFO, errmsg.str());
                     }
-                    std::cout << "  Running combination routines in 'custom' mode. Primary datasets from all specified files (in the specified group) will be concatenated. Auxilliary (\"random access\") datasets will be IGNORED! If you need auxilliary datasets to be merged into the primary datasets then please merge them in 'normal' mode." << std::endl;
+                    if(worker==0) std::cout << "  Running combination routines in 'custom' mode. Primary datasets from all specified files (in the specified group) will be concatenated. Auxilliary (\"random access\") datasets will be IGNORED! If you need auxilliary datasets to be merged into the primary datasets then please merge them in 'normal' mode." << std::endl;
                     // TODO: It would actually be good to write out an extra dataset which records which points come from which files. Could just be an int, and could write out a txt file which gives the mapping from indices to input files. This is too much work for now though.
                 }
 
                 // Check which files are readable (lets us tell the user all at once if there is a bad batch)
                 bool badfiles = false;
                 std::vector<std::size_t> unreadable;
-                std::cout << "  Checking readability of temp files...             "<<std::endl;
+                if(worker==0) std::cout << "  Checking readability of temp files...             "<<std::endl;
                 for (size_t i = 0; i < num; i++)
                 {
                     // Simple Progress monitor
@@ -290,7 +317,7 @@ namespace Gambit
                 }
                 if(badfiles)
                 {
-                    std::cerr << "  WARNING: Unreadable temporary HDF5 files detected! Indices were "<<unreadable<<std::endl;
+                    if(worker==0) std::cerr << "  WARNING: Unreadable temporary HDF5 files detected! Indices were "<<unreadable<<std::endl;
 
                     if(not skip_unreadable and badfiles)
                     {
@@ -315,7 +342,7 @@ namespace Gambit
                 for (size_t i = 0; i < num; i++)
                 {
                     // Simple Progress monitor
-                    std::cout << "  Scanning temp file "<<i<<" for datasets...             \r"<<std::flush;
+                    if(worker==0) std::cout << "  Scanning temp file "<<i<<" for datasets...             \r"<<std::flush;
 
                     std::string fname = get_fname(i);
                     hid_t file_id, group_id, aux_group_id;
@@ -489,7 +516,32 @@ namespace Gambit
                     if(aux_group_id>-1) HDF5::closeGroup(aux_group_id);
                     if(file_id>-1)      HDF5::closeFile(file_id);
                 }
-                std::cout << "  Finished scanning temp files               "<<std::endl;
+                if(worker==0) std::cout << "  Finished scanning temp files               "<<std::endl;
+            }
+
+            // Share the parameters out between the workers of a parallel combination, round-robin in the
+            // order they were found (which is the same for all workers, since they scan the same files).
+            void hdf5_stuff::assign_workers()
+            {
+                param_worker.clear();
+                size_t next = 0;
+                for (auto it = param_names.begin(), end = param_names.end(); it != end; ++it)
+                {
+                    // Keep the datasets used to locate RA points with the first worker
+                    if (*it == "pointID" or *it == "MPIrank") param_worker[*it] = 0;
+                    else param_worker[*it] = (next++) % n_workers;
+                }
+                for (auto it = aux_param_names.begin(), end = aux_param_names.end(); it != end; ++it)
+                {
+                    if (param_worker.find(*it) == param_worker.end()) param_worker[*it] = (next++) % n_workers;
+                }
+            }
+
+            // Check whether a parameter is assigned to this worker
+            bool hdf5_stuff::owns(const std::string &name) const
+            {
+                auto it = param_worker.find(name);
+                return it != param_worker.end() and it->second == worker;
             }
 
             hdf5_stuff::~hdf5_stuff()
@@ -509,16 +561,17 @@ namespace Gambit
 
                 hid_t old_file = -1;
                 hid_t old_group = -1;
+                unsigned long long old_size = 0; // Length of previous combined output, which goes at the start of every output dataset
                 //std::cout << "resume? " << resume <<std::endl;
                 if (resume)
                 {
-                    // Check if 'file' exists?
-                    if(Utils::file_exists(file))
+                    // Check if 'file' exists? (In parallel mode it has already been moved aside for us)
+                    std::string filebak = combine_backup_name(file);
+                    if(n_workers > 1 ? Utils::file_exists(filebak) : Utils::file_exists(file))
                     {
-                       std::string filebak = file + ".temp.bak";
-                       std::system(("mv " + file + " " + filebak).c_str());
+                       if(n_workers < 2) std::system(("mv " + file + " " + filebak).c_str());
                        //old_file = H5Fopen((file + ".temp.bak").c_str(), H5F_ACC_RDWR, H5P_DEFAULT);
-                       old_file = HDF5::openFile(file + ".temp.bak", false, 'r');
+                       old_file = HDF5::openFile(filebak, false, 'r');
                        if(old_file<0)
                        {
                            std::ostringstream errmsg;
@@ -546,6 +599,7 @@ namespace Gambit
                        HDF5::closeSpace(space);
                        HDF5::closeDataset(old_dataset);
                        size_tot += extra;
+                       old_size = extra;
 
                        // Check for parameters not found in the newer temporary files.
                        // (should not be any aux parameters in here, so don't check for them)
@@ -593,18 +647,42 @@ namespace Gambit
                 }
                 // else everything is cool
 
+                // Work out which parameters this worker is responsible for (all of them, unless running in parallel mode).
+                // The pointID and MPIrank datasets are also copied by any worker with auxilliary parameters, since they
+                // are needed to locate the targets of the RA points.
+                assign_workers();
+                std::vector<std::string> my_aux_names;
+                for (auto it = aux_param_names.begin(), end = aux_param_names.end(); it != end; ++it)
+                {
+                    if (owns(*it)) my_aux_names.push_back(*it);
+                }
+                const bool need_RA_keys = not custom_mode and my_aux_names.size() > 0;
+                std::vector<std::string> my_param_names;
+                for (auto it = param_names.begin(), end = param_names.end(); it != end; ++it)
+                {
+                    if (owns(*it) or (need_RA_keys and (*it == "pointID" or *it == "MPIrank"))) my_param_names.push_back(*it);
+                }
+
+                // In parallel mode each worker writes into its own part file, replacing any left over from a failed attempt
+                std::string out_file = file;
+                if (n_workers > 1)
+                {
+                    out_file = combine_part_name(file, worker);
+                    std::remove(out_file.c_str());
+                }
+
                 //hid_t new_file = H5Fcreate(file.c_str(), H5F_ACC_TRUNC, H5P_DEFAULT, H5P_DEFAULT);
-                hid_t new_file = HDF5::openFile(file,false,'w'); // No overwrite allowed, this file shouldn't exist
+                hid_t new_file = HDF5::openFile(out_file,false,'w'); // No overwrite allowed, this file shouldn't exist
                 if(new_file<0)
                 {
                     std::ostringstream errmsg;
-                    errmsg << "Failed to create output file '"<<file<<"'!";
+                    errmsg << "Failed to create output file '"<<out_file<<"'!";
                     printer_error().raise(LOCAL_INFO, errmsg.str());
                 }
 
                 hid_t new_group = HDF5::openGroup(new_file, group_name); // Recursively creates required group structure
 
-                if (aux_param_names.size() > 0) for (unsigned long i=0; i<aux_groups.size(); ++i)
+                if (my_aux_names.size() > 0) for (unsigned long i=0; i<aux_groups.size(); ++i)
                 {
                      std::vector<unsigned long long> rank, ptid;
 
@@ -696,8 +774,49 @@ namespace Gambit
                     HDF5::closeFile(file_id);
                 }
 
-                // TODO: Ack, getting a "too many open files" error. I guess we need
-                // to do this in batches, but that's quite a pain to arrange.
+                // Output datasets are created the first time data for them is found
+                std::unordered_set<std::string> created_params;
+
+                // Copy the previous combined output first, one parameter at a time
+                if (old_group >= 0)
+                {
+                    int counter = 1;
+                    for (auto it = my_param_names.begin(), end = my_param_names.end(); it != end; ++it, ++counter)
+                    {
+                        if(worker==0) std::cout << "  Copying previous combined datasets... "<<int(100*counter/my_param_names.size())<<"%   (copied "<<counter<<" parameters of "<<my_param_names.size()<<")        \r"<<std::flush;
+
+                        HDF5::errorsOff();
+                        hid_t old_dataset  = HDF5::openDataset(old_group, *it, true); // Allow fail; parameter may not be in previous combined output
+                        hid_t old_dataset2 = HDF5::openDataset(old_group, *it + "_isvalid", true);
+                        HDF5::errorsOn();
+                        if(old_dataset>=0 and old_dataset2>=0)
+                        {
+                            create_output_datasets(new_group, *it, old_dataset, old_dataset2, size_tot, created_params);
+                            hid_t dataset_out   = HDF5::openDataset(new_group, *it);
+                            hid_t dataset2_out  = HDF5::openDataset(new_group, (*it)+"_isvalid");
+                            std::vector<hid_t> no_datasets;
+                            std::vector<unsigned long long> no_sizes;
+                            unsigned long long no_size = 0;
+                            size_t start = 0;
+                            Enter_HDF5<copy_hdf5>(dataset_out, no_datasets, no_size, no_sizes, old_dataset, start);
+                            Enter_HDF5<copy_hdf5>(dataset2_out, no_datasets, no_size, no_sizes, old_dataset2, start);
+                            HDF5::closeDataset(dataset_out);
+                            HDF5::closeDataset(dataset2_out);
+                        }
+                        else
+                        {
+                            std::cout << "Failed to open previous combined dataset for parameter "<<*it<<std::endl;
+                        }
+                        if(old_dataset>=0)  HDF5::closeDataset(old_dataset);
+                        if(old_dataset2>=0) HDF5::closeDataset(old_dataset2);
+                    }
+                    if(worker==0) std::cout << "  Copying previous combined datasets... Done.                         "<<std::endl;
+                }
+
+                // We can't keep all the temp files open at once (we get a "too many open files"
+                // error), so they are processed in batches. Each batch of files is opened only
+                // once, and every parameter is copied from it in turn, so the number of file
+                // opens is independent of the number of parameters.
                 const size_t BATCH_SIZE = 50;
 
                 // Compute number of batches required
@@ -708,183 +827,124 @@ namespace Gambit
                    N_BATCHES += 1;
                 }
 
-                int counter = 1;
-                for (auto it = param_names.begin(), end = param_names.end(); it != end; ++it, ++counter)
+                size_t offset = old_size; // where to begin writing the next batch in output datasets
+                for(size_t batch_i = 0; batch_i < N_BATCHES; batch_i++)
                 {
-                    // Simple Progress monitor
-                    std::cout << "  Combining primary datasets... "<<int(100*counter/param_names.size())<<"%   (copied "<<counter<<" parameters of "<<param_names.size()<<")        \r"<<std::flush;
+                    size_t THIS_BATCH_SIZE = BATCH_SIZE;
+                    if(remainder>0 and batch_i==N_BATCHES-1) THIS_BATCH_SIZE = remainder; // Last batch is incomplete
 
-                    //std::vector<hid_t> file_ids(files.size(),-1);
-                    //std::vector<hid_t> group_ids(files.size(),-1);
-                    //std::vector<hid_t> datasets(files.size(),-1);
-                    //std::vector<hid_t> datasets2(files.size(),-1);
+                    // IDs for this batch
+                    std::vector<unsigned long long> batch_sizes(THIS_BATCH_SIZE,0);
+                    std::vector<hid_t> file_ids (THIS_BATCH_SIZE,-1);
+                    std::vector<hid_t> group_ids(THIS_BATCH_SIZE,-1);
 
-                    size_t offset = 0; // where to begin writing the next batch in output datasets
-                    for(size_t batch_i = 0, end = N_BATCHES; batch_i < end; batch_i++)
+                    // Open the files of this batch (once for all parameters)
+                    for (size_t file_i = 0; file_i < THIS_BATCH_SIZE; file_i++)
                     {
-                        size_t pc_offset = 0; // possible extra offset due to previous combined datasets. Only batch 0 will use this.
-                        long long valid_dset = -1; // index of a validly opened dataset (-1 if none)
-                        size_t THIS_BATCH_SIZE = BATCH_SIZE;
-                        std::vector<unsigned long long> batch_sizes(BATCH_SIZE,0);
-                         // IDs for this batch
-                        std::vector<hid_t> file_ids (THIS_BATCH_SIZE,-1);
-                        std::vector<hid_t> group_ids(THIS_BATCH_SIZE,-1);
-                        std::vector<hid_t> datasets (THIS_BATCH_SIZE,-1);
-                        std::vector<hid_t> datasets2(THIS_BATCH_SIZE,-1);
+                        size_t i = file_i + batch_i * BATCH_SIZE;
+                        batch_sizes[file_i] = sizes[i]; // Collect pre-measured dataset sizes for this batch
 
-                        // Collect all the HDF5 ids need to combine this parameter for this batch of files
-                        if(remainder>0 and batch_i==N_BATCHES-1) THIS_BATCH_SIZE = remainder; // Last batch is incomplete
-                        //std::cout << "   Processing temp files "<<batch_i*BATCH_SIZE<<" to "<<batch_i*BATCH_SIZE+THIS_BATCH_SIZE<<std::endl;
-                        //std::cout << "BATCH "<< batch_i << std::endl;
-                        for (size_t file_i = 0, end = THIS_BATCH_SIZE; file_i < end; file_i++)
+                        // Skip this file if it wasn't successfully opened earlier
+                        if(files[i]>=0)
                         {
-                            size_t i = file_i + batch_i * BATCH_SIZE;
-
-                            //std::cout << i << " ("<<(files[i]>=0)<<"), ";
-
-                            hid_t file_id  = -1;
-                            hid_t group_id = -1;
-                            hid_t dataset = -1;
-                            hid_t dataset2 = -1;
-                            batch_sizes[file_i] = sizes[i]; // Collect pre-measured dataset sizes for this batch
-
-                            // Skip this file if it wasn't successfully opened earlier
-                            if(files[i]>=0)
+                            std::string fname = get_fname(i);
+                            if(not HDF5::checkFileReadable(fname))
                             {
-                                // Reopen files
-                                // NOTE: RAM problems largely solved, but footprint could be lowered even more if we only open one file at a time.
-                                std::string fname = get_fname(i);
-                                if(not HDF5::checkFileReadable(fname))
-                                {
-                                  std::cout <<"files["<<i<<"] = "<<files[i]<<std::endl;
-                                  std::cerr<<"WARNING! "<<fname<<" was not readable! This should have been caught earlier!"<<std::endl;
-                                }
-                                file_id = HDF5::openFile(fname);
-                                files[i] = file_id;
-                                group_id = HDF5::openGroup(file_id, group_name, true); // final argument prevents group from being created
-                                if(group_id>=0)
-                                {
-                                   HDF5::errorsOff();
-                                   dataset  = HDF5::openDataset(group_id, *it, true); // Allow fail; not all parameters must exist in all temp files
-                                   dataset2 = HDF5::openDataset(group_id, *it + "_isvalid", true);
-                                   HDF5::errorsOn();
-                                }
-
-                                if(dataset>=0)
-                                {
-                                   if(dataset2>=0) valid_dset = file_i; // Use this one to determine dataset types for this batch (TODO: will be bad if it doesn't match other batches! could make this more robust)
-                                   else
-                                   {
-                                      std::ostringstream errmsg;
-                                      errmsg << "Error opening dataset '"<<*it<<"_isvalid' from temp file "<<i<<"! Main dataset was opened, but 'isvalid' dataset failed to open! It may be corrupted.";
-                                      printer_error().raise(LOCAL_INFO, errmsg.str());
-                                   }
-                                }
+                              std::cout <<"files["<<i<<"] = "<<files[i]<<std::endl;
+                              std::cerr<<"WARNING! "<<fname<<" was not readable! This should have been caught earlier!"<<std::endl;
                             }
-
-                            datasets [file_i] = dataset;
-                            datasets2[file_i] = dataset2;
-                            file_ids [file_i] = file_id;
-                            group_ids[file_i] = group_id;
+                            file_ids[file_i] = HDF5::openFile(fname);
+                            files[i] = file_ids[file_i];
+                            group_ids[file_i] = HDF5::openGroup(file_ids[file_i], group_name, true); // final argument prevents group from being created
                         }
+                    }
+
+                    // Measure total size of datasets for this batch of files
+                    unsigned long long batch_size_tot = 0;
+                    for(auto st = batch_sizes.begin(); st != batch_sizes.end(); ++st)
+                    {
+                       batch_size_tot += *st;
+                    }
+
+                    int counter = 1;
+                    for (auto it = my_param_names.begin(), end = my_param_names.end(); it != end; ++it, ++counter)
+                    {
+                        // Simple Progress monitor
+                        if(worker==0) std::cout << "  Combining primary datasets... batch "<<batch_i+1<<" of "<<N_BATCHES<<", "<<int(100*counter/my_param_names.size())<<"%   (copied "<<counter<<" parameters of "<<my_param_names.size()<<")        \r"<<std::flush;
 
-                        // Get id for old combined output for this parameter
-                        hid_t old_dataset = -1, old_dataset2 = -1;
-                        if (resume and batch_i==0) // Only copy old dataset once, during first batch of files
+                        long long valid_dset = -1; // index of a validly opened dataset (-1 if none)
+                        std::vector<hid_t> datasets (THIS_BATCH_SIZE,-1);
+                        std::vector<hid_t> datasets2(THIS_BATCH_SIZE,-1);
+
+                        // Collect the dataset IDs needed to combine this parameter for this batch of files
+                        for (size_t file_i = 0; file_i < THIS_BATCH_SIZE; file_i++)
                         {
-                            //std::cout << "Opening previous combined dataset for parameter "<<*it<<std::endl;
+                            if(group_ids[file_i]<0) continue;
                             HDF5::errorsOff();
-                            old_dataset  = HDF5::openDataset(old_group, *it, true); // Allow fail; may be no previous combined output
-                            old_dataset2 = HDF5::openDataset(old_group, *it + "_isvalid", true);
+                            datasets [file_i] = HDF5::openDataset(group_ids[file_i], *it, true); // Allow fail; not all parameters must exist in all temp files
+                            datasets2[file_i] = HDF5::openDataset(group_ids[file_i], *it + "_isvalid", true);
                             HDF5::errorsOn();
-                            if(old_dataset<0) std::cout << "Failed to open previous combined dataset for parameter "<<*it<<std::endl; // debugging
-                            if(old_dataset>0)
+
+                            if(datasets[file_i]>=0)
                             {
-                                hid_t space = H5Dget_space(old_dataset);
-                                hsize_t dim_t = H5Sget_simple_extent_npoints(space);
-                                H5Sclose(space);
-                                pc_offset = dim_t; // Record size of old combined dataset, needed to get correct offset for next batch
+                               if(datasets2[file_i]>=0) valid_dset = file_i;
+                               else
+                               {
+                                  std::ostringstream errmsg;
+                                  errmsg << "Error opening dataset '"<<*it<<"_isvalid' from temp file "<<file_i + batch_i * BATCH_SIZE<<"! Main dataset was opened, but 'isvalid' dataset failed to open! It may be corrupted.";
+                                  printer_error().raise(LOCAL_INFO, errmsg.str());
+                               }
                             }
                         }
 
-                        // With new batching system, could get a batch with no data for this parameter. This is ok,
-                        // so we just skip it.
-                        // TODO: Could put in a check to make sure that SOME batch copies data.
-                        // This should happen though, since the parameter name must have been retrieved from *some*
-                        // file or other, so it would just be double-checking that this worked correctly.
-                        if(valid_dset>=0 or old_dataset>=0)
+                        // Could get a batch with no data for this parameter. This is ok, the corresponding
+                        // section of the output datasets is then just left invalid.
+                        if(valid_dset>=0)
                         {
-                            hid_t type, type2;
-                            if(valid_dset<0)
-                            {
-                               // Parameter not in any of the new temp files, must only be in the old combined output, get type from there.
-                               type  = H5Dget_type(old_dataset);
-                               type2 = H5Dget_type(old_dataset2);
-                            }
-                            else
-                            {
-                               // Get the type from a validly opened dataset in temp file
-                               type  = H5Dget_type(datasets[valid_dset]);
-                               type2 = H5Dget_type(datasets2[valid_dset]);
-                            }
-                            if(type<0 or type2<0)
-                            {
-                               std::ostringstream errmsg;
-                               errmsg << "Failed to detect type for dataset '"<<*it<<"'! The dataset is supposedly valid, so this does not make sense. It must be a bug, please report it. (valid_dset="<<valid_dset<<")";
-                               printer_error().raise(LOCAL_INFO, errmsg.str());
-                            }
-
-                            if(batch_i==0) // Only want to create the output dataset once!
-                            {
-                               // Create datasets
-                               //std::cout<<"Creating dataset '"<<*it<<"' in file:group "<<file<<":"<<group_name<<std::endl;
-                               setup_hdf5_points(new_group, type, type2, size_tot, *it);
-                            }
+                            create_output_datasets(new_group, *it, datasets[valid_dset], datasets2[valid_dset], size_tot, created_params);
 
                             // Reopen dataset for writing
                             hid_t dataset_out   = HDF5::openDataset(new_group, *it);
                             hid_t dataset2_out  = HDF5::openDataset(new_group, (*it)+"_isvalid");
-                            //std::cout << "Copying parameter "<<*it<<std::endl; // debug
-
-                            // Measure total size of datasets for this batch of files
-                            // (not counting previous combined output, which will be copied in batch 0)
-                            unsigned long long batch_size_tot = 0;
-                            for(auto it = batch_sizes.begin(); it != batch_sizes.end(); ++it)
-                            {
-                               batch_size_tot += *it;
-                            }
-
-                            //Enter_HDF5<copy_hdf5>(dataset_out, datasets, size_tot_l, sizes, old_dataset);
-                            //Enter_HDF5<copy_hdf5>(dataset2_out, datasets2, size_tot_l, sizes, old_dataset2);
 
                             // Do the copy!!!
-                            Enter_HDF5<copy_hdf5>(dataset_out, datasets, batch_size_tot, batch_sizes, old_dataset, offset);
-                            Enter_HDF5<copy_hdf5>(dataset2_out, datasets2, batch_size_tot, batch_sizes, old_dataset2, offset);
+                            hid_t no_old_dataset = -1;
+                            Enter_HDF5<copy_hdf5>(dataset_out, datasets, batch_size_tot, batch_sizes, no_old_dataset, offset);
+                            Enter_HDF5<copy_hdf5>(dataset2_out, datasets2, batch_size_tot, batch_sizes, no_old_dataset, offset);
 
                             // Close resources
                             HDF5::closeDataset(dataset_out);
                             HDF5::closeDataset(dataset2_out);
-
-                            // Move offset so that next batch is written to correct place in output file
-                            offset += batch_size_tot + pc_offset;
-                        }
-                        else
-                        {
-                            std::cout << "No datasets found for parameter "<<*it<<" in file batch "<<batch_i<<". Moving on to next batch since there seems to be nothing to copy in this one." << std::endl;
                         }
 
-                        // Close files etc. associated with this batch
-                        for (size_t file_i = 0, end = file_ids.size(); file_i < end; file_i++)
+                        for (size_t file_i = 0; file_i < THIS_BATCH_SIZE; file_i++)
                         {
                             if(datasets[file_i]>=0)  HDF5::closeDataset(datasets[file_i]);
                             if(datasets2[file_i]>=0) HDF5::closeDataset(datasets2[file_i]);
-                            if(group_ids[file_i]>=0) HDF5::closeGroup(group_ids[file_i]);
-                            if(file_ids[file_i]>=0)  HDF5::closeFile(file_ids[file_i]);
                         }
+                    }
 
-                    } // end batch, begin processing next batch of files.
+                    // Close files etc. associated with this batch
+                    for (size_t file_i = 0; file_i < THIS_BATCH_SIZE; file_i++)
+                    {
+                        if(group_ids[file_i]>=0) HDF5::closeGroup(group_ids[file_i]);
+                        if(file_ids[file_i]>=0)  HDF5::closeFile(file_ids[file_i]);
+                    }
+
+                    // Move offset so that next batch is written to correct place in output file
+                    offset += batch_size_tot;
+
+                } // end batch, begin processing next batch of files.
+
+                // Report any parameters for which no data was found at all
+                for (auto it = my_param_names.begin(), end = my_param_names.end(); it != end; ++it)
+                {
+                    if(created_params.find(*it) == created_params.end())
+                    {
+                        std::cout << "No datasets found for parameter "<<*it<<" in any temp file." << std::endl;
+                    }
                 }
-                std::cout << "  Combining primary datasets... Done.                                 "<<std::endl;
+                if(worker==0) std::cout << "  Combining primary datasets... Done.                                 "<<std::endl;
 
                 // Debug: early exit to check what primary combined output looks like
                 // Flush and close output file
@@ -926,11 +986,25 @@ namespace Gambit
                    {
                       std::unordered_map<PPIDpair, unsigned long long, PPIDHash,PPIDEqual> RA_write_hash(get_RA_write_hash(new_group, left_to_match));
 
+                      // Look up the output position of every RA point once, rather than once for
+                      // every auxilliary parameter. Points not found are flagged with RA_NO_TARGET.
+                      std::vector<std::vector<unsigned long long> > RA_targets(ranks.size());
+                      #pragma omp parallel for schedule(dynamic)
+                      for(std::size_t i=0; i<ranks.size(); ++i)
+                      {
+                         RA_targets[i].resize(ranks[i].size());
+                         for(std::size_t j=0; j<ranks[i].size(); ++j)
+                         {
+                            auto ihash = RA_write_hash.find(PPIDpair(ptids[i][j],ranks[i][j]));
+                            RA_targets[i][j] = (ihash != RA_write_hash.end() ? ihash->second : RA_NO_TARGET);
+                         }
+                      }
+
                       /// Now copy the RA datasets
-                      counter = 1; //reset counter
-                      for (auto it = aux_param_names.begin(), end = aux_param_names.end(); it != end; ++it, ++counter)
+                      int counter = 1;
+                      for (auto it = my_aux_names.begin(), end = my_aux_names.end(); it != end; ++it, ++counter)
                       {
-                          std::cout << "  Combining auxilliary datasets... "<<int(100*counter/aux_param_names.size())<<"%    (merged "<<counter<<" parameters of "<<aux_param_names.size()<<")         \r"<<std::flush;
+                          if(worker==0) std::cout << "  Combining auxilliary datasets... "<<int(100*counter/my_aux_names.size())<<"%    (merged "<<counter<<" parameters of "<<my_aux_names.size()<<")         \r"<<std::flush;
                           std::vector<hid_t> file_ids, group_ids, datasets, datasets2;
                           int valid_dset  = -1; // index of a validly opened dataset (-1 if none)
 
@@ -1028,7 +1102,7 @@ namespace Gambit
                           // Reopen output datasets for copying
                           hid_t dataset_out  = HDF5::openDataset(new_group, *it);
                           hid_t dataset2_out = HDF5::openDataset(new_group, (*it)+"_isvalid");
-                          Enter_HDF5<ra_copy_hdf5>(dataset_out, dataset2_out, datasets, datasets2, size_tot, RA_write_hash, ptids, ranks, aux_sizes, old_dataset, old_dataset2);
+                          Enter_HDF5<ra_copy_hdf5>(dataset_out, dataset2_out, datasets, datasets2, size_tot, RA_targets, ptids, ranks, aux_sizes, old_dataset, old_dataset2);
 
                           // Close resources
                           for (int i = 0, end = datasets.size(); i < end; i++)
@@ -1040,11 +1114,11 @@ namespace Gambit
                               if(file_ids[i]>=0)  HDF5::closeFile(file_ids[i]);
                           }
                       }
-                      std::cout << "  Combining auxilliary datasets... Done.                 "<<std::endl;
+                      if(worker==0) std::cout << "  Combining auxilliary datasets... Done.                 "<<std::endl;
                    }
                    else
                    {
-                      std::cout << "  Combining auxilliary datasets... None found, skipping. "<<std::endl;
+                      if(worker==0) std::cout << "  Combining auxilliary datasets... None found, skipping. "<<std::endl;
                    }
                 }
 
@@ -1059,18 +1133,177 @@ namespace Gambit
 
                 if (do_cleanup and not custom_mode) // Cleanup disabled for custom mode. This is only for "routine" combination during scan resuming.
                 {
-                    if (resume)
+                    remove_combined_inputs(file, root_file_name, files.size(), resume);
+                }
+            }
+
+            /// Name of the file into which a worker of the parallel combination writes its datasets
+            std::string combine_part_name(const std::string &file, const size_t worker)
+            {
+                std::stringstream ss;
+                ss << file << "_part_" << worker;
+                return ss.str();
+            }
+
+            /// Name to which previous combined output is moved while it is merged with new temporary files
+            std::string combine_backup_name(const std::string &file)
+            {
+                return file + ".temp.bak";
+            }
+
+            /// Delete the temporary files (and backup of previous combined output) after a successful combination
+            void remove_combined_inputs(const std::string &file, const std::string &root_file_name, const size_t num, const bool resume)
+            {
+                if (resume)
+                {
+                    std::system(("rm -f " + combine_backup_name(file)).c_str());
+                }
+
+                for (size_t i = 0; i < num; i++)
+                {
+                    std::stringstream ss;
+                    ss << i;
+                    std::system(("rm -f " + root_file_name + "_temp_" + ss.str()).c_str());
+                }
+            }
+
+            /// Parallel version of combine_hdf5_files. HDF5 is not thread-safe in a standard build, so the workers are
+            /// separate (forked) processes, each of which writes the datasets assigned to it into its own part file. Every
+            /// dataset is copied in large contiguous blocks by exactly one worker, including the merging of its RA points.
+            void combine_hdf5_files_parallel(const std::string output_file, const std::string &base_file_name, const std::string &group, const size_t num, const bool resume, const bool cleanup, const bool skip, const size_t n_workers, const std::vector<std::string> input_files)
+            {
+                if(n_workers < 2)
+                {
+                    combine_hdf5_files(output_file, base_file_name, group, num, resume, cleanup, skip, input_files);
+                    return;
+                }
+
+                // Move any previous combined output aside before the workers start, so that they can all read it
+                if(Utils::file_exists(output_file))
+                {
+                    if(not resume)
+                    {
+                        std::ostringstream errmsg;
+                        errmsg << "Error combining HDF5 temporary data! The output file '"<<output_file<<"' already exists, but we are not resuming from it.";
+                        printer_error().raise(LOCAL_INFO, errmsg.str());
+                    }
+                    if(not HDF5::checkFileReadable(output_file))
+                    {
+                        std::ostringstream errmsg;
+                        errmsg << "Error combining HDF5 temporary data! A previous combined output file was found ("<<output_file<<"), but it could not be successfully opened. It may be corrupted due to a bad shutdown. You could try deleting/moving the old combined data file and attempting the combination again, though of course the old combined data will be lost." << std::endl;
+                        printer_error().raise(LOCAL_INFO, errmsg.str());
+                    }
+                    std::system(("mv " + output_file + " " + combine_backup_name(output_file)).c_str());
+                }
+
+                std::cout << "  Combining in parallel with "<<n_workers<<" worker processes" << std::endl;
+                std::cerr << std::flush;
+
+                // Launch the workers
+                std::vector<pid_t> pids;
+                for(size_t w = 0; w < n_workers; ++w)
+                {
+                    pid_t pid = fork();
+                    if(pid < 0) break;
+                    if(pid == 0)
                     {
-                        std::system(("rm -f " + file + ".temp.bak").c_str());
+                        int status = EXIT_SUCCESS;
+                        try
+                        {
+                            combine_hdf5_files_part(output_file, base_file_name, group, num, resume, skip, w, n_workers, input_files);
+                        }
+                        catch(std::exception &e)
+                        {
+                            std::cerr << "  Worker "<<w<<" of parallel HDF5 combination failed: " << e.what() << std::endl;
+                            status = EXIT_FAILURE;
+                        }
+                        std::cout << std::flush;
+                        std::cerr << std::flush;
+                        _exit(status);
                     }
+                    pids.push_back(pid);
+                }
+
+                // Wait for them all to finish
+                bool failed = (pids.size() != n_workers);
+                for(auto it = pids.begin(); it != pids.end(); ++it)
+                {
+                    int status;
+                    if(waitpid(*it, &status, 0) < 0 or not WIFEXITED(status) or WEXITSTATUS(status) != EXIT_SUCCESS) failed = true;
+                }
+                if(failed)
+                {
+                    std::ostringstream errmsg;
+                    errmsg << "Error combining HDF5 temporary data! ";
+                    if(pids.size() != n_workers) errmsg << "Only "<<pids.size()<<" of "<<n_workers<<" worker processes could be started.";
+                    else errmsg << "One or more of the worker processes failed (see above).";
+                    if(resume) errmsg << " Any previous combined output has been left in "<<combine_backup_name(output_file)<<".";
+                    printer_error().raise(LOCAL_INFO, errmsg.str());
+                }
+
+                merge_combined_parts(output_file, group, n_workers);
+
+                if(cleanup and input_files.empty()) // Cleanup disabled for custom mode, as in the serial version
+                {
+                    remove_combined_inputs(output_file, base_file_name, num, resume);
+                }
+            }
 
-                    for (int i = 0, end = files.size(); i < end; i++)
+            /// Merge the part files written by the workers of a parallel combination into a single output file
+            void merge_combined_parts(const std::string &file, const std::string &group_name, const size_t n_workers)
+            {
+                hid_t new_file = HDF5::openFile(file,false,'w'); // No overwrite allowed, this file shouldn't exist
+                if(new_file<0)
+                {
+                    std::ostringstream errmsg;
+                    errmsg << "Failed to create output file '"<<file<<"'!";
+                    printer_error().raise(LOCAL_INFO, errmsg.str());
+                }
+                hid_t new_group = HDF5::openGroup(new_file, group_name); // Recursively creates required group structure
+
+                for(size_t w = 0; w < n_workers; ++w)
+                {
+                    std::cout << "  Merging output of worker "<<w+1<<" of "<<n_workers<<"...        \r"<<std::flush;
+
+                    std::string part = combine_part_name(file, w);
+                    hid_t part_file = HDF5::openFile(part, false, 'r');
+                    hid_t part_group = HDF5::openGroup(part_file, group_name, true); // final argument prevents group from being created
+                    if(part_group < 0)
                     {
-                        std::stringstream ss;
-                        ss << i;
-                        std::system(("rm -f " + root_file_name + "_temp_" + ss.str()).c_str());
+                        std::ostringstream errmsg;
+                        errmsg << "Error merging output of parallel HDF5 combination! Group "<<group_name<<" could not be opened in part file '"<<part<<"'.";
+                        printer_error().raise(LOCAL_INFO, errmsg.str());
                     }
+
+                    H5G_info_t group_info;
+                    H5Gget_info(part_group, &group_info);
+                    for(hsize_t i = 0; i < group_info.nlinks; i++)
+                    {
+                        char name_buffer[1000];
+                        H5Gget_objname_by_idx(part_group, i, name_buffer, (size_t)1000);
+
+                        // The pointID and MPIrank datasets may be written by several workers. The copies are identical, and
+                        // the one from the first worker (to which they are assigned) is merged first, so just skip the rest.
+                        if(H5Lexists(new_group, name_buffer, H5P_DEFAULT) > 0) continue;
+
+                        if(H5Ocopy(part_group, name_buffer, new_group, name_buffer, H5P_DEFAULT, H5P_DEFAULT) < 0)
+                        {
+                            std::ostringstream errmsg;
+                            errmsg << "Error merging output of parallel HDF5 combination! Failed to copy dataset '"<<name_buffer<<"' from part file '"<<part<<"'.";
+                            printer_error().raise(LOCAL_INFO, errmsg.str());
+                        }
+                    }
+
+                    HDF5::closeGroup(part_group);
+                    HDF5::closeFile(part_file);
+                    std::remove(part.c_str());
                 }
+                std::cout << "  Merging output of workers... Done.                 "<<std::endl;
+
+                // Flush and close output file
+                H5Fflush(new_file, H5F_SCOPE_GLOBAL);
+                HDF5::closeGroup(new_group);
+                HDF5::closeFile(new_file);
             }
 
             /// Helper function to create output hash map for RA points
@@ -70,7 +70,13 @@ namespace Gambit
       , mpiranks_isvalid(location_id, "MPIrank_isvalid", true, 'r')
       , current_dataset_index(0)
       , current_point(nullpoint)
+      , ppid_index_built(false)
      {
+       pointIDs.set_read_length(READLENGTH);
+       pointIDs_isvalid.set_read_length(READLENGTH);
+       mpiranks.set_read_length(READLENGTH);
+       mpiranks_isvalid.set_read_length(READLENGTH);
+
        if(all_datasets.size()<2)
        {
          std::ostringstream errmsg;
@@ -228,6 +234,29 @@ namespace Gambit
 
      /// @{ Private functions
 
+     /// Build the index from PPIDs to dataset entries, reading the pointID/MPIrank datasets in large blocks
+     void HDF5Reader::build_PPID_index()
+     {
+        const ulong dset_length = get_dataset_length();
+        ppid_index.clear();
+        ppid_index.reserve(dset_length);
+        for(ulong start = 0; start < dset_length; start += READLENGTH)
+        {
+           const ulong length = std::min<ulong>(READLENGTH, dset_length - start);
+           std::vector<unsigned long> pid    = pointIDs.get_chunk(start, length);
+           std::vector<int>           pvalid = pointIDs_isvalid.get_chunk(start, length);
+           std::vector<int>           rank   = mpiranks.get_chunk(start, length);
+           std::vector<int>           rvalid = mpiranks_isvalid.get_chunk(start, length);
+           for(ulong i = 0; i < length; ++i)
+           {
+              // Keep the first match, as the iterative search would find it
+              if(pvalid[i] and rvalid[i]) ppid_index.emplace(PPIDpair(pid[i],rank[i]), start+i);
+           }
+        }
+        ppid_index_built = true;
+        logger() << LogTags::printers << LogTags::info << "Built PPID index of HDF5 reader with "<<ppid_index.size()<<" points (file="<<file<<", group="<<group<<")." << EOM;
+     }
+
      /// Search for the PPID supplied in the input data and return the index of the first match
      ulong HDF5Reader::get_index_from_PPID(const PPIDpair ppid)
      {
@@ -245,9 +274,15 @@ namespace Gambit
         else
         {
            // Gotta search for it.
-           std::ostringstream errmsg;
-           errmsg << "Arbitrary point access has not yet been implemented for the HDF5Reader! Currently only iterated access through a dataset works.";
-           printer_error().raise(LOCAL_INFO, errmsg.str());
+           if(not ppid_index_built) build_PPID_index();
+           auto it = ppid_index.find(ppid);
+           if(it == ppid_index.end())
+           {
+              std::ostringstream errmsg;
+              errmsg << "Requested point "<<ppid<<" was not found in the input datasets (file="<<file<<", group="<<group<<")!";
+              printer_error().raise(LOCAL_INFO, errmsg.str());
+           }
+           out_index = it->second;
         }
         mem_point = ppid;
         mem_index = out_index;
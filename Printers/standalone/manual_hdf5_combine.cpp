@@ -53,6 +53,9 @@ void usage()
           "\n   -h/--help             Display this usage information"
           "\n   -f/--force            Attempt combination while ignoring missing temporary files"
           "\n   -c/--cleanup          Delete temporary files after successful combination"
+          "\n   -j/--jobs <n>         Combine in parallel using n worker processes. Each worker"
+          "\n                         combines a share of the datasets into its own part file,"
+          "\n                         and the parts are then merged into the output file."
           "\n   -o/--out <path>       Set output folder (default is same folder as temp files)"
           "\n                         (note, this first creates the output in the default place,"
           "\n                         and then just moves it)"
@@ -90,6 +93,7 @@ int main(int argc, char* argv[])
      {"force", no_argument, 0, 'f'},
      {"help",  no_argument, 0, 'h'},
      {"cleanup", no_argument, 0 , 'c'},
+     {"jobs", required_argument, 0, 'j'},
      {"in", required_argument, 0, 'i'},
      {"out", required_argument, 0, 'o'},
      {0,0,0,0},
@@ -104,12 +108,13 @@ int main(int argc, char* argv[])
    bool error_if_inconsistent = true;
    bool do_cleanup = false;
    bool move_output = false;
+   size_t n_workers = 1;
    size_t num;
    bool combined_file_exists;
 
    while(iarg != -1)
    {
-     iarg = getopt_long(argc, argv, "fhcoi:", primary_options, &index);
+     iarg = getopt_long(argc, argv, "fhcj:o:i:", primary_options, &index);
      switch (iarg)
      {
        case 'h':
@@ -123,6 +128,13 @@ int main(int argc, char* argv[])
        case 'c':
          do_cleanup = true;
          break;
+       case 'j':
+         {
+            int n = atoi(optarg);
+            if(n < 1) usage();
+            n_workers = n;
+         }
+         break;
        case 'o':
          outpath = optarg; 
          move_output = true;
@@ -166,7 +178,7 @@ int main(int argc, char* argv[])
         std::cerr << errmsg.str() << std::endl;
         exit(EXIT_FAILURE); 
       }
-      HDF5::combine_hdf5_files(finalfile, "", group, num, false, false, true, input_files);
+      HDF5::combine_hdf5_files_parallel(finalfile, "", group, num, false, false, true, n_workers, input_files);
    }
    else
    {
@@ -216,7 +228,7 @@ int main(int argc, char* argv[])
       // for some to just be missing. These will just be ignored if they fail
       // to open.
  
-      HDF5::combine_hdf5_files(tmp_comb_file, finalfile, group, num, combined_file_exists, do_cleanup, !error_if_inconsistent);
+      HDF5::combine_hdf5_files_parallel(tmp_comb_file, finalfile, group, num, combined_file_exists, do_cleanup, !error_if_inconsistent, n_workers);
    }
 
    std::cout<<"  Combination finished successfully!"<<std::endl;
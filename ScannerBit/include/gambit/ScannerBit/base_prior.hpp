@@ -22,6 +22,7 @@
 #ifndef __BASE_PRIORS_HPP__
 #define __BASE_PRIORS_HPP__
 
+#include <string>
 #include <vector>
 #include <unordered_map>
 
@@ -43,6 +44,9 @@ namespace Gambit
         protected:
             std::vector<std::string> param_names;
 
+            /// Positions of param_names in the flat parameter array used by indexed_transform (-1 if absent)
+            std::vector<int> param_indices;
+
         public:
             BasePrior() : param_size(0), param_names(0) {}
 
@@ -56,6 +60,32 @@ namespace Gambit
 
             virtual double operator()(const std::vector<double> &) const {return 0.0;}
 
+            /// Fix the positions of this prior's parameters in the flat parameter array.  Called once at
+            /// scan start; parameters that do not appear in the layout are skipped by indexed_transform.
+            virtual void setIndices(const std::unordered_map<std::string, int> &layout)
+            {
+                param_indices.clear();
+                for (auto it = param_names.begin(), end = param_names.end(); it != end; ++it)
+                {
+                    auto pos = layout.find(*it);
+                    param_indices.push_back(pos == layout.end() ? -1 : pos->second);
+                }
+            }
+
+            /// Transformation from the unit hypercube straight into the flat parameter array laid out by setIndices.
+            /// Priors without their own version fall back on the map-based transform.
+            virtual void indexed_transform(const std::vector<double> &unitpars, double *output) const
+            {
+                std::unordered_map<std::string, double> outputMap;
+                transform(unitpars, outputMap);
+                for (int i = 0, end = param_indices.size(); i < end; i++)
+                {
+                    if (param_indices[i] < 0) continue;
+                    auto it = outputMap.find(param_names[i]);
+                    if (it != outputMap.end()) output[param_indices[i]] = it->second;
+                }
+            }
+
             inline unsigned int size() const {return param_size;}
 
             inline void setSize(const unsigned int size) {param_size = size;}
@@ -127,6 +127,29 @@ namespace Gambit
                 return ret_val;
             }
 
+            /// Index-resolved fast path used by like_ptr.  Functions that can read their parameters straight from
+            /// a flat array, ordered as in getParameters(), override setParameterLayout (returning true) and main_indexed.
+            virtual bool setParameterLayout(const std::vector<std::string> &) {return false;}
+            virtual ret main_indexed(const double *)
+            {
+                scan_err << "This function does not take an index-resolved parameter array." << scan_end;
+                return ret();
+            }
+
+            /// As operator(), but handing the parameters over as the flat array set up by setParameterLayout.
+            ret call_indexed(const double *params)
+            {
+                Gambit::Scanner::Plugins::plugin_info.set_calculating(true);
+                if(Gambit::Printers::auto_increment())
+                {
+                  ++Gambit::Printers::get_point_id();
+                }
+                ret ret_val = main_indexed(params);
+                Gambit::Scanner::Plugins::plugin_info.set_calculating(false);
+
+                return ret_val;
+            }
+
             void setPurpose(const std::string p) {purpose = p;}
             void setPrinter(printer* p) {main_printer = p;}
             void setPrior(Priors::BasePrior *p) {prior = p;}
@@ -305,17 +328,60 @@ namespace Gambit
             typedef scan_ptr<double (std::unordered_map<std::string, double> &)> s_ptr;
             std::unordered_map<std::string, double> map;
 
+            /// Index-resolved parameter layout, fixed once when the function is attached: the prior writes
+            /// into params (ordered as getParameters()), which is passed on directly if the function takes
+            /// it, or else copied into map through pointers to its entries.
+            std::vector<double> params;
+            std::vector<double *> map_values;
+            bool indexed;
+
+            void setLayout()
+            {
+                params.clear();
+                map_values.clear();
+                indexed = false;
+                if (!this->get()) return;
+
+                std::vector<std::string> names = (*this)->getParameters();
+                std::unordered_map<std::string, int> layout;
+                for (int i = 0, end = names.size(); i < end; i++)
+                {
+                    layout[names[i]] = i;
+                    map_values.push_back(&map[names[i]]);
+                }
+                params.resize(names.size());
+                (*this)->getPrior().setIndices(layout);
+                indexed = (*this)->setParameterLayout(names);
+            }
+
         public:
-            like_ptr(){}
-            like_ptr(const like_ptr &in) : s_ptr (in){}
+            like_ptr() : indexed(false) {}
+            like_ptr(const like_ptr &in) : s_ptr (in) {setLayout();}
             //like_ptr(like_ptr &&in) : s_ptr (std::move(in)) {}
-            like_ptr(void *in) : s_ptr(in) {}
+            like_ptr(void *in) : s_ptr(in) {setLayout();}
+
+            like_ptr &operator=(const like_ptr &in)
+            {
+                this->s_ptr::operator=(in);
+                setLayout();
+
+                return *this;
+            }
 
             double operator()(const std::vector<double> &vec)
             {
                 int rank = (*this)->getRank();
-                (*this)->getPrior().transform(vec, map);
-                double ret_val = (*this)->operator()(map);
+                (*this)->getPrior().indexed_transform(vec, params.data());
+                double ret_val;
+                if (indexed)
+                {
+                    ret_val = (*this)->call_indexed(params.data());
+                }
+                else
+                {
+                    for (int i = 0, end = params.size(); i < end; i++) *map_values[i] = params[i];
+                    ret_val = (*this)->operator()(map);
+                }
                 unsigned long long int id = Gambit::Printers::get_point_id();
                 (*this)->getPrinter().print(ret_val, (*this)->getPurpose(), rank, id);
                 (*this)->getPrinter().enable(); // Make sure printer is re-enabled (might have been disabled by invalid point error)
@@ -65,6 +65,26 @@ namespace Gambit
                                         outputMap[*str_it] = *(v_it++) + *(m_it++);
                                 }
                         }
+
+                        void indexed_transform(const std::vector <double> &unitpars, double *output) const
+                        {
+                                std::vector<double> vec(unitpars.size());
+                                
+                                auto v_it = vec.begin();
+                                for (auto elem_it = unitpars.begin(), elem_end = unitpars.end(); elem_it != elem_end; elem_it++, v_it++)
+                                {
+                                        *v_it = std::tan(M_PI*(*elem_it - 0.5));      
+                                }
+                                
+                                col.ElMult(vec);
+                                
+                                v_it = vec.begin();
+                                auto m_it = mean.begin();
+                                for (auto idx_it = param_indices.begin(), idx_end = param_indices.end(); idx_it != idx_end; idx_it++, v_it++, m_it++)
+                                {
+                                        if (*idx_it >= 0) output[*idx_it] = *v_it + *m_it;
+                                }
+                        }
                         
                         double operator()(const std::vector<double> &vec) const
                         {
@@ -50,6 +50,8 @@ namespace Gambit
             // References to component prior objects
             std::vector<BasePrior*> my_subpriors;
             std::vector<std::string> shown_param_names;
+            // Per-subprior unit cube slices for indexed_transform, sized once in setIndices
+            mutable std::vector<std::vector<double>> sub_units;
                 
         public:
         
@@ -72,6 +74,30 @@ namespace Gambit
                     (*it)->transform(subUnit, outputMap);
                 }
             }
+
+            void setIndices(const std::unordered_map<std::string, int> &layout)
+            {
+                BasePrior::setIndices(layout);
+                sub_units.clear();
+                for (auto it = my_subpriors.begin(), end = my_subpriors.end(); it != end; it++)
+                {
+                    (*it)->setIndices(layout);
+                    sub_units.emplace_back((*it)->size());
+                }
+            }
+
+            // Transformation from unit hypercube straight into the flat parameter array
+            void indexed_transform(const std::vector<double> &unitPars, double *output) const
+            {
+                std::vector<double>::const_iterator unit_it = unitPars.begin();
+                auto sub_it = sub_units.begin();
+                for (auto it = my_subpriors.begin(), end = my_subpriors.end(); it != end; it++, sub_it++)
+                {
+                    std::copy(unit_it, unit_it + sub_it->size(), sub_it->begin());
+                    unit_it += sub_it->size();
+                    (*it)->indexed_transform(*sub_it, output);
+                }
+            }
             
             //~CompositePrior() noexcept
             ~CompositePrior()
@@ -44,6 +44,15 @@ namespace Gambit
                     outputMap[*it] = *(it_vec++);
                 }
             }
+
+            void indexed_transform(const std::vector<double> &unitpars, double *output) const
+            {
+                auto it_vec = unitpars.begin();
+                for (auto it = param_indices.begin(), end = param_indices.end(); it != end; ++it, ++it_vec)
+                {
+                    if (*it >= 0) output[*it] = *it_vec;
+                }
+            }
         };
 
         class None : public BasePrior
@@ -86,6 +86,16 @@ namespace Gambit
 
                 iter = (iter + 1)%value.size();
             }
+
+            void indexed_transform(const std::vector<double> &, double *output) const
+            {
+                for (auto it = param_indices.begin(), end = param_indices.end(); it != end; ++it)
+                {
+                    if (*it >= 0) output[*it] = value[iter];
+                }
+
+                iter = (iter + 1)%value.size();
+            }
         };
 
         //if the parameter shares multiple different parameters
@@ -94,9 +104,10 @@ namespace Gambit
         private:
             std::string name;
             std::vector<double> scale, shift;
+            int name_index;
 
         public:
-            MultiPriors(const std::vector<std::string>& param, const Options& options) : BasePrior(param), scale(param.size(), 1.0), shift(param.size(), 0.0)
+            MultiPriors(const std::vector<std::string>& param, const Options& options) : BasePrior(param), scale(param.size(), 1.0), shift(param.size(), 0.0), name_index(-1)
             {
                 if (options.hasKey("same_as"))
                 {
@@ -119,7 +130,7 @@ namespace Gambit
                 }
             }
 
-            MultiPriors(std::string name_in, std::unordered_map<std::string, std::pair<double, double> > &map_in)
+            MultiPriors(std::string name_in, std::unordered_map<std::string, std::pair<double, double> > &map_in) : name_index(-1)
             {
                 std::string::size_type pos_old = 0;
                 std::string::size_type pos = name_in.find("+");
@@ -157,6 +168,31 @@ namespace Gambit
                     outputMap[*it] = (*it1)*value + *it2;
                 }
             }
+
+            void setIndices(const std::unordered_map<std::string, int> &layout)
+            {
+                BasePrior::setIndices(layout);
+                auto pos = layout.find(name);
+                name_index = (pos == layout.end() ? -1 : pos->second);
+            }
+
+            void indexed_transform(const std::vector<double> &, double *output) const
+            {
+                if (name_index < 0)
+                {
+                    scan_err << "same_as:  parameter " << name << " is not part of the parameter layout." << scan_end;
+                    return;
+                }
+
+                double value = output[name_index];
+
+                // The combined "a+b+...+name" entry has no slot (and no scale/shift), so only
+                // the individual parameters are written.
+                for (unsigned int i = 0, end = std::min(param_indices.size(), std::min(scale.size(), shift.size())); i < end; i++)
+                {
+                    if (param_indices[i] >= 0) output[param_indices[i]] = scale[i]*value + shift[i];
+                }
+            }
         };
 
         LOAD_PRIOR(fixed_value, FixedPrior)
@@ -219,6 +219,11 @@ namespace Gambit
                 output[myparameter] = (T::inv(unitpars[0]*(upper-lower) + lower)-shift_out)/scale_out;
             }
 
+            void indexed_transform(const std::vector<double> &unitpars, double *output) const
+            {
+                if (param_indices[0] >= 0) output[param_indices[0]] = (T::inv(unitpars[0]*(upper-lower) + lower)-shift_out)/scale_out;
+            }
+
             double operator()(const std::vector<double> &vec) const {return T::prior(vec[0]*scale+shift)*scale;}
         };
 
@@ -113,6 +113,9 @@ namespace Gambit
             Printers::BaseBasePrinter& getPrinter();
             Scanner::like_ptr getLogLike();
 
+            /// Find the previously processed chunk containing a given dataset index (done_chunks.end() if none)
+            ChunkSet::const_iterator find_done_chunk(std::size_t index) const;
+
             /// The reader object in use for the scan
             Printers::BaseBaseReader* reader;
 
@@ -140,7 +143,8 @@ namespace Gambit
             /// Size of chunks to distribute to worker processes
             unsigned long long chunksize;
 
-            /// Chunks describing the points that can be auto-skipped (because they have been processed previously)
+            /// Chunks describing the points that can be auto-skipped (because they have been processed previously).
+            /// Kept merged, so that no two chunks overlap or touch.
             ChunkSet done_chunks;
 
             /// Names of all output that the primary printer knows about at startup (things GAMBIT plans to print from the likelihood loop)
@@ -1115,7 +1115,36 @@ namespace Gambit
       // Define the set of points that can be auto-skipped
       void PPDriver::set_done_chunks(const ChunkSet& in_done_chunks)
       {
-         done_chunks = in_done_chunks;
+         // Merge overlapping and adjacent chunks, so that each index is in at most one chunk
+         // and the chunk containing it can be found by a binary search on the start indices
+         done_chunks.clear();
+         for(ChunkSet::const_iterator it=in_done_chunks.begin();
+              it!=in_done_chunks.end(); ++it)
+         {
+            if(not done_chunks.empty() and it->start <= done_chunks.rbegin()->end + 1)
+            {
+               if(it->end > done_chunks.rbegin()->end)
+               {
+                  Chunk merged(done_chunks.rbegin()->start, it->end);
+                  done_chunks.erase(std::prev(done_chunks.end()));
+                  done_chunks.insert(done_chunks.end(), merged);
+               }
+            }
+            else
+            {
+               done_chunks.insert(done_chunks.end(), *it);
+            }
+         }
+      }
+
+      /// Find the previously processed chunk containing a given dataset index (done_chunks.end() if none)
+      ChunkSet::const_iterator PPDriver::find_done_chunk(std::size_t index) const
+      {
+         // Last chunk starting at or before index; as done_chunks are disjoint, only it can contain index
+         ChunkSet::const_iterator it = done_chunks.upper_bound(Chunk(index,index));
+         if(it==done_chunks.begin()) return done_chunks.end();
+         --it;
+         return it->iContain(index) ? it : done_chunks.end();
       }
 
       /// Compute start/end indices for a given rank process, given previous "done_chunk" data.
@@ -1139,12 +1168,15 @@ namespace Gambit
             // through the dataset, but skipping points that have already been processed.
             while(not stop)
             {
-               bool point_is_done = false;
-               for(ChunkSet::const_iterator donechunk=done_chunks.begin();
-                    donechunk!=done_chunks.end(); ++donechunk)
+               // Check if the next scheduled point has been processed previously
+               ChunkSet::const_iterator donechunk = find_done_chunk(next_point);
+               bool point_is_done = (donechunk!=done_chunks.end());
+
+               // If so, jump straight to the last point of the processed run (or the end of the
+               // dataset). The points in between would neither count towards this chunk nor end it.
+               if(point_is_done and next_point < total_length and chunk_length < chunksize)
                {
-                  // Check if the next scheduled point has been processed previously
-                  if(donechunk->iContain(next_point)) point_is_done = true;
+                  next_point = std::min<std::size_t>(donechunk->end, total_length);
                }
 
                if(not point_is_done) 
@@ -51,6 +51,7 @@
 #define __threadsafe_rng_hpp__
 
 #include <random>
+#include <vector>
 #include <chrono>
 
 #include "gambit/Utils/util_macros.hpp"
@@ -83,6 +84,13 @@ namespace Gambit
         /// Operators for compliance with RandomNumberEngine interface -> random distribution sampling
         virtual result_type min() = 0; // Needs to connect to equivalent function in underlying rng class
         virtual result_type max() = 0; // "   "
+
+        /// Fill out with n uniform deviates from (0,1), identical to n successive calls of
+        /// std::generate_canonical<double, 32>(*this)
+        virtual void draw_canonical(double* out, size_t n)
+        {
+          for (size_t i = 0; i < n; ++i) out[i] = std::generate_canonical<double, 32>(*this);
+        }
     };
 
     /// Give an inline implementation of the destructor, to prevent link errors but keep base class pure virtual.
@@ -123,6 +131,13 @@ namespace Gambit
         virtual result_type min() { return rngs[omp_get_thread_num()].min(); }
         virtual result_type max() { return rngs[omp_get_thread_num()].max(); }
 
+        /// Bulk uniform deviates, looking up this thread's engine once rather than once per call
+        virtual void draw_canonical(double* out, size_t n)
+        {
+          Engine& engine = rngs[omp_get_thread_num()];
+          for (size_t i = 0; i < n; ++i) out[i] = std::generate_canonical<double, 32>(engine);
+        }
+
       private:
 
         /// Pointer to array of RNGs, one each for each thread
@@ -130,6 +145,48 @@ namespace Gambit
 
     };
 
+    /// Stateless counter-based random bit generator.
+    /// Deviate n of stream s is a pure function of (seed, s, n), so independent streams can be
+    /// handed out to threads in any order and still reproduce the same sequence regardless of the
+    /// number of threads.  Uses the SplitMix64 mixing function; cheap to construct, so it is fine
+    /// to create one per block of work.
+    class counter_rng
+    {
+
+      public:
+        typedef unsigned long long result_type;
+
+        /// Create the generator for stream number 'stream' of the sequence identified by 'seed'
+        counter_rng(result_type seed, result_type stream)
+         : key(mix(seed ^ mix(stream + golden_gamma)))
+         , counter(0)
+        {}
+
+        /// Generate the next random integer in this stream
+        result_type operator()() { return mix(key + golden_gamma * ++counter); }
+
+        /// Range of the generated integers
+        static constexpr result_type min() { return 0; }
+        static constexpr result_type max() { return ~result_type(0); }
+
+      private:
+
+        static constexpr result_type golden_gamma = 0x9E3779B97F4A7C15ULL;
+
+        /// SplitMix64 finaliser
+        static result_type mix(result_type z)
+        {
+          z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+          z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+          return z ^ (z >> 31);
+        }
+
+        /// Stream key and position within the stream
+        result_type key;
+        result_type counter;
+
+    };
+
   }
 
   class EXPORT_SYMBOLS Random
@@ -143,6 +200,10 @@ namespace Gambit
       /// Draw a single uniform random deviate from the interval (0,1) using the chosen RNG engine
       static double draw();
 
+      /// Draw n uniform random deviates from the interval (0,1) into deviates, giving exactly
+      /// the same sequence as n successive calls of draw()
+      static void draw(std::vector<double>& deviates, size_t n);
+
       /// Return a threadsafe wrapper for the chosen RNG engine (to be passed to e.g. std library
       /// distribution function objects)
       static Utils::threadsafe_rng& rng() { return *local_rng; }
@@ -118,6 +118,14 @@ namespace Gambit
      assert_contains(inkey);
      _values[inkey]=value;
    }
+
+   /// Get a pointer to the stored value of a named parameter.
+   /// Stays valid as long as the parameter is not removed, i.e. for the lifetime of this object.
+   double* ModelParameters::getValuePtr(std::string const &inkey)
+   {
+     assert_contains(inkey);
+     return &_values.at(inkey);
+   }
   
    /// Set many parameter values using another ModelParameters object
    void ModelParameters::setValues(ModelParameters const& donor, bool missing_is_error)
@@ -81,6 +81,14 @@ namespace Gambit
     return std::generate_canonical<double, 32>(rng());
   }
 
+  /// Draw n uniform random deviates in the range (0,1) using the chosen RNG engine
+  void Random::draw(std::vector<double>& deviates, size_t n)
+  {
+    if (local_rng == NULL) create_rng_engine("default");
+    deviates.resize(n);
+    if (n > 0) rng().draw_canonical(deviates.data(), n);
+  }
+
 }
 
 
@@ -94,4 +94,24 @@ if(HDF5_FOUND)
   endif()
 endif()
 
+# Add the daFunk integration thread-scaling benchmark
+if(EXISTS "${PROJECT_SOURCE_DIR}/Elements/")
+  if(EXISTS "${PROJECT_SOURCE_DIR}/Utils/")
+    add_gambit_executable(daFunk_benchmark ""
+                          SOURCES ${PROJECT_SOURCE_DIR}/Elements/examples/daFunk_integration_benchmark.cpp
+                                  ${GAMBIT_BASIC_COMMON_OBJECTS}
+                          )
+    set_target_properties(daFunk_benchmark PROPERTIES RUNTIME_OUTPUT_DIRECTORY "${PROJECT_SOURCE_DIR}/Elements/bin")
+  endif()
+endif()
 
+# Add the stand-alone test of module function memoisation
+if(EXISTS "${PROJECT_SOURCE_DIR}/Elements/")
+  if(EXISTS "${PROJECT_SOURCE_DIR}/Utils/")
+    add_gambit_executable(functor_memoisation_test ""
+                          SOURCES ${PROJECT_SOURCE_DIR}/Elements/examples/functor_memoisation_test.cpp
+                                  ${GAMBIT_ALL_COMMON_OBJECTS}
+                          )
+    set_target_properties(functor_memoisation_test PROPERTIES RUNTIME_OUTPUT_DIRECTORY "${PROJECT_SOURCE_DIR}/Elements/bin")
+  endif()
+endif()